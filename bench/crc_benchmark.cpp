@@ -0,0 +1,59 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "robomaster/utils.h"
+
+namespace robomaster {
+    /**
+     * @brief The time stamp counter, zero when the platform has none.
+     */
+    static uint64_t get_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0x0;
+#endif
+    }
+
+    static void BM_CRC16(benchmark::State& state) {
+        const auto kernel = static_cast<CRCKernel>(state.range(0)); const auto length = static_cast<size_t>(state.range(1));
+        if (!is_supported(kernel)) { state.SkipWithError("kernel not supported"); return; }
+        std::vector<uint8_t> data(length); for (size_t i = 0; i < length; i++) { data[i] = static_cast<uint8_t>(i * 31); }
+        const auto cycles = get_cycles();
+        for (auto _ : state) { benchmark::DoNotOptimize(get_crc16(data.data(), data.size(), kernel)); benchmark::ClobberMemory(); }
+        const auto elapsed = get_cycles() - cycles;
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * length));
+        if (elapsed != 0x0) { state.counters["bytes_per_cycle"] = static_cast<double>(state.iterations() * length) / static_cast<double>(elapsed); }
+    }
+
+    BENCHMARK(BM_CRC16)->ArgsProduct({{CRC_KERNEL_TABLE, CRC_KERNEL_SLICING, CRC_KERNEL_CLMUL}, {27, 151, 255, 4096}});
+} // namespace robomaster
@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include <thread>
+#include <time.h>
+
+#include <benchmark/benchmark.h>
+
+#include "robomaster/fleet.h"
+#include "robomaster/loopback.h"
+
+namespace robomaster {
+    static constexpr auto STD_PERIOD = std::chrono::milliseconds(10);
+
+    static double cpu_time(const clockid_t clock) {
+        timespec time{}; clock_gettime(clock, &time); return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+    }
+
+    static void drain(std::vector<std::unique_ptr<LoopbackBus>>& remotes) {
+        std::array<can_frame, STD_MAX_BATCH_SIZE> frames{}; std::array<std::chrono::system_clock::time_point, STD_MAX_BATCH_SIZE> timestamps{}; size_t count = 0x0;
+        for (const auto& remote : remotes) { while (remote->read_frames(frames, timestamps, count) && count != 0x0) { } }
+    }
+
+    /**
+     * @brief One iteration is one heartbeat period of the whole fleet, every robot gets a chassis command and the remote
+     * ends are drained. The cpu time of the reactor threads is the cpu time of the process without the benchmark thread.
+     */
+    static void BM_Fleet(benchmark::State& state) {
+        const auto robots = static_cast<size_t>(state.range(0)), threads = static_cast<size_t>(state.range(1));
+        RoboMasterFleet fleet; std::vector<std::unique_ptr<LoopbackBus>> remotes;
+        if (!fleet.init(threads)) { state.SkipWithError("fleet init failed"); return; }
+        for (size_t i = 0; i < robots; i++) {
+            auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.0); remotes.push_back(std::move(remote));
+            if (!fleet.add(std::move(local), "loopback")) { state.SkipWithError("fleet add failed"); return; }
+        }
+        const auto process = cpu_time(CLOCK_PROCESS_CPUTIME_ID), thread = cpu_time(CLOCK_THREAD_CPUTIME_ID); const auto start = std::chrono::steady_clock::now();
+        auto next = start;
+        for (auto _ : state) {
+            for (size_t i = 0; i < robots; i++) { fleet[i].set_chassis_velocity(0.5f, 0.0f, 10.0f); }
+            drain(remotes); next += STD_PERIOD; std::this_thread::sleep_until(next);
+        }
+        const auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const auto reactor = std::max((cpu_time(CLOCK_PROCESS_CPUTIME_ID) - process) - (cpu_time(CLOCK_THREAD_CPUTIME_ID) - thread), 0.0) / wall;
+        state.counters["cpu_per_robot"] = reactor / static_cast<double>(robots);
+        state.counters["cpu_per_reactor"] = reactor / static_cast<double>(threads);
+        state.counters["robots_per_core"] = reactor > 0.0 ? static_cast<double>(robots) / reactor : 0.0;
+    }
+
+    BENCHMARK(BM_Fleet)->Args({1, 1})->Args({8, 1})->Args({32, 1})->Args({32, 2})->Iterations(100)->UseRealTime()->Unit(benchmark::kMillisecond);
+} // namespace robomaster
@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "robomaster/message.h"
+#include "robomaster/parser.h"
+#include "robomaster/utils.h"
+#include "allocation.h"
+
+namespace robomaster {
+    static std::vector<std::vector<uint8_t>> frames_of(const size_t payload) {
+        const auto data = Message(0x202, 0x0903, 1, std::vector<uint8_t>(payload, 0x42)).vector(); std::vector<std::vector<uint8_t>> frames;
+        for (size_t i = 0; i < data.size(); i += 8) { frames.emplace_back(data.begin() + static_cast<long>(i), data.begin() + static_cast<long>(std::min(i + 8, data.size()))); }
+        return frames;
+    }
+
+    static void report(benchmark::State& state, const size_t messages, const size_t allocations) {
+        state.counters["messages"] = benchmark::Counter(static_cast<double>(messages), benchmark::Counter::kIsRate);
+        state.counters["allocs_per_message"] = static_cast<double>(allocations) / static_cast<double>(std::max<size_t>(messages, 1));
+    }
+
+    static void BM_StreamParser(benchmark::State& state) {
+        const auto frames = frames_of(static_cast<size_t>(state.range(0))); StreamParser parser; size_t messages = 0x0;
+        const auto time = std::chrono::system_clock::now(); const auto allocations = get_allocation_count();
+        for (auto _ : state) {
+            for (const auto& frame : frames) { parser.push(frame, time, [&messages](const std::span<const uint8_t> message, auto, auto) { benchmark::DoNotOptimize(message.data()); messages++; }); }
+        } report(state, messages, get_allocation_count() - allocations);
+    }
+
+    static void BM_StreamParserLastFrame(benchmark::State& state) {
+        const auto frames = frames_of(static_cast<size_t>(state.range(0))); StreamParser parser; size_t messages = 0x0; const auto time = std::chrono::system_clock::now();
+        const auto completion = [&messages](const std::span<const uint8_t> message, auto, auto) { benchmark::DoNotOptimize(message.data()); messages++; };
+        for (auto _ : state) {
+            for (size_t i = 0; i + 1 < frames.size(); i++) { parser.push(frames[i], time, completion); }
+            const auto start = std::chrono::steady_clock::now(); parser.push(frames.back(), time, completion);
+            state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        } if (static_cast<benchmark::IterationCount>(messages) != state.iterations()) { state.SkipWithError("message lost"); }
+    }
+
+    static void BM_VectorReassembly(benchmark::State& state) {
+        const auto frames = frames_of(static_cast<size_t>(state.range(0))); std::vector<uint8_t> buffer; size_t length = 0x0, messages = 0x0;
+        const auto allocations = get_allocation_count();
+        for (auto _ : state) {
+            for (const auto& frame : frames) {
+                buffer.insert(std::end(buffer), frame.begin(), frame.end());
+                if (length == 0) {
+                    auto iterator = buffer.cbegin();
+                    while (iterator != buffer.cend()) {
+                        iterator = std::find(iterator, std::cend(buffer), 0x55); buffer.erase(std::cbegin(buffer), iterator);
+                        if (buffer.size() < 4) { break; } if (buffer[3] == get_crc8(buffer.data(), 3)) { length = buffer[1]; break; } ++iterator;
+                    }
+                } else if (length <= buffer.size()) {
+                    if (get_crc16(buffer.data(), length - 2) == get_little_endian(buffer[length - 2], buffer[length - 1])) {
+                        const auto message = std::vector(std::cbegin(buffer), std::cbegin(buffer) + static_cast<long>(length)); benchmark::DoNotOptimize(message.data()); messages++;
+                    } buffer.erase(std::cbegin(buffer), std::cbegin(buffer) + static_cast<long>(length)); length = 0x0;
+                }
+            }
+        } report(state, messages, get_allocation_count() - allocations);
+    }
+
+    static std::vector<uint8_t> corrupted_stream(const size_t size, const int density) {
+        std::mt19937 generator{42}; std::uniform_int_distribution<int> byte{0, 0xff}, percent{0, 99}; std::vector<uint8_t> stream;
+        const auto message = Message(0x202, 0x0903, 1, std::vector<uint8_t>(40, 0x42)).vector();
+        while (stream.size() < size) {
+            for (size_t i = 0; i < 256; i++) { stream.push_back(percent(generator) < density ? 0x55 : static_cast<uint8_t>(byte(generator))); }
+            stream.insert(stream.end(), message.begin(), message.end());
+        } return stream;
+    }
+
+    static void BM_StreamParserResync(benchmark::State& state) {
+        const auto stream = corrupted_stream(1 << 16, static_cast<int>(state.range(0))); const auto chunk = static_cast<size_t>(state.range(1));
+        StreamParser parser; size_t messages = 0x0; const auto time = std::chrono::system_clock::now();
+        for (auto _ : state) {
+            for (size_t i = 0; i < stream.size(); i += chunk) {
+                parser.push(std::span{stream}.subspan(i, std::min(chunk, stream.size() - i)), time, [&messages](const std::span<const uint8_t> message, auto, auto) { benchmark::DoNotOptimize(message.data()); messages++; });
+            }
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+        state.counters["messages"] = benchmark::Counter(static_cast<double>(messages), benchmark::Counter::kIsRate);
+    }
+
+    BENCHMARK(BM_StreamParser)->Arg(17)->Arg(133);
+    BENCHMARK(BM_StreamParserLastFrame)->Arg(17)->Arg(141)->Arg(245)->UseManualTime();
+    BENCHMARK(BM_VectorReassembly)->Arg(17)->Arg(133);
+    BENCHMARK(BM_StreamParserResync)->ArgsProduct({{1, 10, 50}, {8, 64}});
+} // namespace robomaster
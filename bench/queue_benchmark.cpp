@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <mutex>
+#include <queue>
+
+#include <benchmark/benchmark.h>
+
+#include "robomaster/queue.h"
+#include "allocation.h"
+
+namespace robomaster {
+    /**
+     * @brief The former sender queue, a std::queue behind a mutex which drops the front message when full.
+     */
+    class LockedQueue {
+        std::queue<Message> queue_; std::mutex mutex_;
+
+    public:
+        Message pop() {
+            std::lock_guard lock{this->mutex_};
+            if (this->queue_.empty()) { return Message(0x0, {}); }
+            const Message msg = this->queue_.front(); this->queue_.pop(); return msg;
+        }
+
+        void push(const Message& message) {
+            std::lock_guard lock{this->mutex_};
+            if (STD_MAX_QUEUE_SIZE <= this->queue_.size()) { this->queue_.pop(); }
+            this->queue_.push(message);
+        }
+    };
+
+    static void report(benchmark::State& state, const size_t allocations) {
+        state.counters["messages"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+        if (state.thread_index() != 0) { return; }
+        state.counters["allocs_per_message"] = static_cast<double>(allocations) / static_cast<double>(std::max<benchmark::IterationCount>(state.iterations() * state.threads(), 1));
+    }
+
+    static void BM_LockedQueue(benchmark::State& state) {
+        static LockedQueue queue; const auto message = Message(0x201, 0x0309, 1, std::vector<uint8_t>(16, 0x42)); const auto allocations = get_allocation_count();
+        for (auto _ : state) { queue.push(message); const auto popped = queue.pop(); benchmark::DoNotOptimize(popped.get_type()); }
+        report(state, get_allocation_count() - allocations);
+    }
+
+    static void BM_Queue(benchmark::State& state) {
+        static Queue queue; const auto message = Message(0x201, 0x0309, 1, std::vector<uint8_t>(16, 0x42)); auto popped = Message(0x0, {}); queue.pop(popped);
+        const auto allocations = get_allocation_count();
+        for (auto _ : state) { queue.push(message); queue.pop(popped); benchmark::DoNotOptimize(popped.get_type()); }
+        report(state, get_allocation_count() - allocations);
+    }
+
+    BENCHMARK(BM_LockedQueue)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK(BM_Queue)->ThreadRange(1, 8)->UseRealTime();
+} // namespace robomaster
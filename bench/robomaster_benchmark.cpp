@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "robomaster/robomaster.h"
+#include "allocation.h"
+
+namespace robomaster {
+    static void report(benchmark::State& state, const size_t allocations) {
+        state.counters["calls"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+        state.counters["allocs_per_call"] = static_cast<double>(allocations) / static_cast<double>(std::max<benchmark::IterationCount>(state.iterations(), 1));
+    }
+
+    static void BM_SetChassisVelocity(benchmark::State& state) {
+        RoboMaster robomaster; const auto allocations = get_allocation_count();
+        for (auto _ : state) { robomaster.set_chassis_velocity(0.5f, 0.0f, 10.0f); }
+        report(state, get_allocation_count() - allocations);
+    }
+
+    static void BM_SetGimbalPosition(benchmark::State& state) {
+        RoboMaster robomaster; const auto allocations = get_allocation_count();
+        for (auto _ : state) { robomaster.set_gimbal_position(100, -100); }
+        report(state, get_allocation_count() - allocations);
+    }
+
+    static void BM_SetBlasterMode(benchmark::State& state) {
+        RoboMaster robomaster; const auto allocations = get_allocation_count();
+        for (auto _ : state) { robomaster.set_blaster_mode(BLASTER_MODE_GEL, 2); }
+        report(state, get_allocation_count() - allocations);
+    }
+
+    static void BM_SetLEDMode(benchmark::State& state) {
+        RoboMaster robomaster; const auto allocations = get_allocation_count();
+        for (auto _ : state) { robomaster.set_led_mode(LED_MODE_STATIC, LED_MASK_ALL, 0xff, 0x00, 0x00); }
+        report(state, get_allocation_count() - allocations);
+    }
+
+    BENCHMARK(BM_SetChassisVelocity);
+    BENCHMARK(BM_SetGimbalPosition);
+    BENCHMARK(BM_SetBlasterMode);
+    BENCHMARK(BM_SetLEDMode);
+} // namespace robomaster
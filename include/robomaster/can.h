@@ -24,14 +24,32 @@
 
 #pragma once
 #include <net/if.h>
-#include <linux/can.h>
-#include <string>
+#include <sys/socket.h>
+#include <array>
+#include <atomic>
+
+#include "transport.h"
 
 namespace robomaster {
+    /**
+     * @brief Socket options of the can bus which are applied by the kernel before frames reach the reader.
+     */
+    struct CANProfile {
+        /**
+         * @brief Deliver the sent frames to other sockets on the same interface (CAN_RAW_LOOPBACK), on by default like in the kernel.
+         */
+        bool loopback = true;
+
+        /**
+         * @brief Deliver the sent frames back to this socket (CAN_RAW_RECV_OWN_MSGS), requires loopback.
+         */
+        bool receive_own = false;
+    };
+
     /**
      * @brief This class manage the io of the can bus.
      */
-    class CANBus {
+    class CANBus final : public Transport {
         /**
          * @brief The Socket for the CanBus.
          */
@@ -47,32 +65,97 @@ namespace robomaster {
          */
         sockaddr_can address_;
 
+        /**
+         * @brief The socket options which are applied on init.
+         */
+        CANProfile profile_;
+
+        /**
+         * @brief Preallocated message headers for the batched receive.
+         */
+        std::array<mmsghdr, STD_MAX_BATCH_SIZE> rx_headers_;
+
+        /**
+         * @brief Preallocated io vectors for the batched receive.
+         */
+        std::array<iovec, STD_MAX_BATCH_SIZE> rx_vectors_;
+
+        /**
+         * @brief Preallocated control buffers for the kernel receive timestamps of the batched receive.
+         */
+        std::array<std::array<uint8_t, 64>, STD_MAX_BATCH_SIZE> rx_controls_;
+
+        /**
+         * @brief Broadcast manager socket of the cyclic sending, -1 when it is not running.
+         */
+        int cyclic_socket_;
+
+        /**
+         * @brief Status if the cyclic sending is running.
+         */
+        std::atomic<bool> is_cyclic_;
+
     public:
         /**
          * @brief Construct the CanSocket object.
+         *
+         * @param profile The socket options which are applied on init.
          */
-        CANBus(/* args */);
+        explicit CANBus(const CANProfile& profile = CANProfile{});
 
         /**
          * @brief Destroy the Can Socket object and close socket.
          */
-        ~CANBus();
+        ~CANBus() override;
 
         /**
-         * @brief Set the timeout for the reading the can socket.
+         * @brief Set the timeout for the reading the can socket, a timeout of zero makes the socket non-blocking.
          *
          * @param seconds Double in seconds.
          */
-        void set_timeout(double seconds) const;
+        void set_timeout(double seconds) override;
 
         /**
-         * @brief Open the can socket by the given can interface name.
+         * @brief Open the can socket by the given can interface name, apply the profile and enable the software receive timestamps.
          *
          * @param interface The name of the can interface.
          * @return true, when the socket is open successfully.
          * @return false, when this socket failed to open.
          */
-        bool init(const std::string& interface);
+        bool init(const std::string& interface) override;
+
+        /**
+         * @brief Install a kernel side filter, the socket receives only standard frames of the given device ids.
+         * An empty list installs a filter which passes all frames, more than CAN_RAW_FILTER_MAX device ids fail.
+         *
+         * @param device_ids The device ids to receive.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        [[nodiscard]] bool set_filter(std::span<const uint32_t> device_ids) override;
+
+        /**
+         * @brief Apply the socket options of the given profile.
+         *
+         * @param profile The can socket profile.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        [[nodiscard]] bool set_profile(const CANProfile& profile) const;
+
+        /**
+         * @brief Get the socket of the can bus.
+         *
+         * @return int as file descriptor.
+         */
+        [[nodiscard]] int get_descriptor() override;
+
+        /**
+         * @brief Request the bitrate of the can interface by rtnetlink.
+         *
+         * @return uint32_t as bitrate in bit/s, 0 when the interface does not report a bit timing, for example a virtual can.
+         */
+        [[nodiscard]] uint32_t get_bitrate() override;
 
         /**
          * @brief Send a can frame over the socket.
@@ -85,6 +168,27 @@ namespace robomaster {
          */
         bool send_frame(uint32_t device_id, const uint8_t data[8], size_t length) const;
 
+        using Transport::send_frames;
+
+        /**
+         * @brief Send multiple can frames over the socket with as few syscalls as possible (sendmmsg).
+         * When the transmit queue is full (ENOBUFS, EAGAIN) it returns at once, the caller retries the unsent frames later.
+         *
+         * @param frames The can frames to send in order.
+         * @param sent The count of frames from the front which are sent.
+         * @return SEND_STATUS_SENT, when all frames are sent.
+         * @return SEND_STATUS_BUSY, when the transmit queue is full.
+         * @return SEND_STATUS_FAILED, when failed.
+         */
+        SendStatus send_frames(std::span<const can_frame> frames, size_t& sent) override;
+
+        /**
+         * @brief The bytes of sent frames of this socket which are not yet on the bus (SIOCOUTQ).
+         *
+         * @return size_t as pending bytes, including the kernel overhead per frame.
+         */
+        [[nodiscard]] size_t get_pending() const;
+
         /**
          * @brief Read the next incoming can frame from the can socket. This function is blocking until the timeout is reached.
          *
@@ -95,5 +199,36 @@ namespace robomaster {
          * @return false  when failed.
          */
         bool read_frame(uint32_t& device_id, uint8_t data[8], size_t& length) const;
+
+        /**
+         * @brief Read all pending can frames up to the size of the given frames with a single syscall (recvmmsg).
+         * This function is blocking until at least one frame is received or the timeout is reached.
+         * The can id of the received frames contains only the device id without flags.
+         *
+         * @param frames The buffer for the received can frames.
+         * @param timestamps The kernel receive timestamps of the frames, must be at least as large as frames.
+         * @param count The count of received frames, zero when the timeout is reached.
+         * @return true, by success or when the timeout is reached.
+         * @return false, when failed.
+         */
+        bool read_frames(std::span<can_frame> frames, std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) override;
+
+        /**
+         * @brief Hand the cycle to the broadcast manager as a single task (CAN_BCM TX_SETUP), the kernel sends it with hrtimer precision.
+         * A broadcast manager task sends one frame per interval, so the interval is the period divided by the frames of a message
+         * and the frames of the messages never swap their order. The kernel removes the task when the process exits.
+         *
+         * @param frames The frames of all messages of the cycle in order, at most 256 frames.
+         * @param message_frames The count of frames of each message.
+         * @param period The period between two messages.
+         * @return true, when the kernel sends the cycle.
+         * @return false, when failed.
+         */
+        bool start_cyclic(std::span<const can_frame> frames, size_t message_frames, std::chrono::microseconds period) override;
+
+        /**
+         * @brief Remove the broadcast manager task.
+         */
+        void stop_cyclic() override;
     };
 } // namespace robomaster
\ No newline at end of file
@@ -49,7 +49,7 @@ namespace robomaster {
      */
     struct StateDetector {
         /**
-         * @brief The timestamp of the hit.
+         * @brief The timestamp of the hit, the kernel receive time of the hit message.
          */
         std::chrono::system_clock::time_point hit_time;
 
@@ -224,6 +224,26 @@ namespace robomaster {
         float pos_z = 0.0f;
     };
 
+    /**
+     * @brief Struct for the acquisition times of the data from the RoboMaster, taken from the kernel receive timestamps.
+     */
+    struct StateTime {
+        /**
+         * @brief Sample time of the motion controller data (battery, esc, imu, velocity, position and attitude).
+         */
+        std::chrono::system_clock::time_point motion_controller;
+
+        /**
+         * @brief Sample time of the gimbal data.
+         */
+        std::chrono::system_clock::time_point gimbal;
+
+        /**
+         * @brief Sample times of the hit detector data.
+         */
+        std::array<std::chrono::system_clock::time_point, 4> detector;
+    };
+
     /**
      * @brief Collection of all data from the motion controller from the RoboMaster.
      */
@@ -272,6 +292,11 @@ namespace robomaster {
          * @brief Attitude data.
          */
         StateAttitude attitude;
+
+        /**
+         * @brief Sample times of the data.
+         */
+        StateTime time;
     };
 
     /**
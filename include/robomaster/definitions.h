@@ -23,8 +23,60 @@
  */
 
 #pragma once
+#include <cstdint>
 
 namespace robomaster {
+    /**
+     * @brief Enum contains the HandlerMode's
+     */
+    enum HandlerMode: uint8_t {
+        HANDLER_MODE_THREADED = 0x00,
+        HANDLER_MODE_REACTOR = 0x01
+    };
+
+    /**
+     * @brief Enum contains the SendStatus's of a transport
+     */
+    enum SendStatus: uint8_t {
+        SEND_STATUS_SENT = 0x00,
+        SEND_STATUS_BUSY = 0x01,
+        SEND_STATUS_FAILED = 0x02
+    };
+
+    /**
+     * @brief Enum contains the CommandClass's of the sender queue, ordered by their priority.
+     * The setpoint classes keep only the newest command by default.
+     */
+    enum CommandClass: uint8_t {
+        COMMAND_CLASS_SAFETY = 0x00,
+        COMMAND_CLASS_MOTION = 0x01,
+        COMMAND_CLASS_CHASSIS_RPM = 0x02,
+        COMMAND_CLASS_CHASSIS_VELOCITY = 0x03,
+        COMMAND_CLASS_GIMBAL = 0x04,
+        COMMAND_CLASS_GIMBAL_VELOCITY = 0x05,
+        COMMAND_CLASS_AUXILIARY = 0x06,
+        COMMAND_CLASS_COUNT = 0x07
+    };
+
+    /**
+     * @brief Enum contains the CommandStatus's of an acknowledged command.
+     */
+    enum CommandStatus: uint8_t {
+        COMMAND_STATUS_ACKNOWLEDGED = 0x00,
+        COMMAND_STATUS_TIMEOUT = 0x01,
+        COMMAND_STATUS_OVERFLOW = 0x02,
+        COMMAND_STATUS_STOPPED = 0x03
+    };
+
+    /**
+     * @brief Enum contains the CRCKernel's
+     */
+    enum CRCKernel: uint8_t {
+        CRC_KERNEL_TABLE = 0x00,
+        CRC_KERNEL_SLICING = 0x01,
+        CRC_KERNEL_CLMUL = 0x02
+    };
+
     /**
      * @brief Enum contains the BlasterMode's
      */
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "robomaster.h"
+
+namespace robomaster {
+    /**
+     * @brief This class drives many RoboMasters from one process. The handlers run in reactor mode and share a fixed pool of
+     * reactor threads, the RoboMasters are assigned round robin, so the thread count does not grow with the fleet.
+     */
+    class RoboMasterFleet {
+        /**
+         * @brief The shared reactor threads, destroyed after the RoboMasters.
+         */
+        std::vector<std::shared_ptr<Reactor>> reactors_;
+
+        /**
+         * @brief The RoboMasters in the order they were added.
+         */
+        std::vector<std::unique_ptr<RoboMaster>> robomasters_;
+
+        /**
+         * @brief Init the RoboMaster on the next reactor and append it to the fleet.
+         *
+         * @param robomaster The RoboMaster.
+         * @param interface can interface name or the name of the transport.
+         * @param config The configuration of the handler, the mode and the reactor are set by the fleet.
+         * @return true, on success, false, if initialization failed.
+         */
+        bool add(std::unique_ptr<RoboMaster> robomaster, const std::string& interface, const HandlerConfig& config);
+
+    public:
+        /**
+         * @brief Constructor of the RoboMasterFleet class.
+         */
+        RoboMasterFleet(/* args */);
+
+        /**
+         * @brief Destructor of the RoboMasterFleet class, stops all RoboMasters and then the reactor threads.
+         */
+        ~RoboMasterFleet() = default;
+
+        /**
+         * @brief Start the reactor threads.
+         *
+         * @param threads The count of reactor threads, at least one.
+         * @return true, on success, false, if a reactor failed to start or the fleet is already initialized.
+         */
+        bool init(size_t threads = 1);
+
+        /**
+         * @brief Add a RoboMaster on the given can interface.
+         *
+         * @param interface can interface name.
+         * @param config The configuration of the handler, the mode and the reactor are set by the fleet.
+         * @return true, on success, false, if initialization failed.
+         */
+        bool add(const std::string& interface, const HandlerConfig& config = HandlerConfig{});
+
+        /**
+         * @brief Add a RoboMaster which uses the given transport, it must provide a descriptor for the reactor mode.
+         *
+         * @param transport The transport for the frame io.
+         * @param interface The name of the transport.
+         * @param config The configuration of the handler, the mode and the reactor are set by the fleet.
+         * @return true, on success, false, if initialization failed.
+         */
+        bool add(std::unique_ptr<Transport> transport, const std::string& interface, const HandlerConfig& config = HandlerConfig{});
+
+        /**
+         * @brief The count of RoboMasters in the fleet.
+         *
+         * @return size_t as count.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * @brief Access a RoboMaster of the fleet.
+         *
+         * @param index The index in the order the RoboMasters were added.
+         * @return RoboMaster& as RoboMaster.
+         */
+        RoboMaster& operator[](size_t index);
+
+        /**
+         * @brief True when all RoboMasters of the fleet are running.
+         *
+         * @return true if all RoboMasters are running. false when one RoboMaster stopped due to an error.
+         */
+        [[nodiscard]] bool is_running() const;
+    };
+} // namespace robomaster
@@ -22,26 +22,146 @@
  * SOFTWARE.
  */
 
+
 #pragma once
 #include <thread>
 #include <condition_variable>
 #include <functional>
+#include <future>
 #include <atomic>
+#include <array>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
 
-#include "can.h"
+#include "transport.h"
+#include "reactor.h"
 #include "message.h"
+#include "parser.h"
+#include "pacer.h"
+#include "pipeline.h"
+#include "registry.h"
+#include "stats.h"
+#include "subscribers.h"
 #include "queue.h"
+#include "scheduling.h"
+#include "definitions.h"
 
 namespace robomaster {
+    /**
+     * @brief The maximal count of messages which are sent with a single call of the transport.
+     */
+    static constexpr size_t STD_MAX_BATCH_MESSAGES = 8;
+
+    /**
+     * @brief The count of commands which can wait for their acknowledgement at once.
+     */
+    static constexpr size_t STD_MAX_PENDING_COMMANDS = 16;
+
+    /**
+     * @brief The default time to wait for the acknowledgement of a command.
+     */
+    static constexpr auto STD_COMMAND_TIMEOUT = std::chrono::milliseconds(500);
+
+    /**
+     * @brief The outcome of a command which requested an acknowledgement.
+     */
+    struct CommandResult {
+        /**
+         * @brief Whether the command was acknowledged, timed out, not tracked or the handler stopped.
+         */
+        CommandStatus status = COMMAND_STATUS_TIMEOUT;
+
+        /**
+         * @brief The time from the push into the sender queue to the reply, zero when not acknowledged.
+         */
+        std::chrono::nanoseconds round_trip{};
+
+        /**
+         * @brief The reply of the device, invalid when not acknowledged.
+         */
+        Message reply{0x0, std::span<const uint8_t>{}};
+    };
+
+    /**
+     * @brief Configuration of the handler.
+     */
+    struct HandlerConfig {
+        /**
+         * @brief Run a receiver and a sender thread or a single epoll reactor thread.
+         */
+        HandlerMode mode = HANDLER_MODE_THREADED;
+
+        /**
+         * @brief Running reactor which is shared with other handlers in reactor mode, a private reactor is created when empty.
+         */
+        std::shared_ptr<Reactor> reactor{};
+
+        /**
+         * @brief Hand a precomputed heartbeat cycle to the transport which sends it on its own (CAN_BCM on the can bus).
+         * Falls back to the userspace heartbeat when the transport does not support it.
+         */
+        bool kernel_heartbeat = false;
+
+        /**
+         * @brief The capacity of the sender queue per command class, a capacity of one keeps only the newest command.
+         */
+        std::array<size_t, COMMAND_CLASS_COUNT> queue_capacity = STD_QUEUE_CAPACITY;
+
+        /**
+         * @brief The bitrate of the bus in bit/s for the pacing of the commands, requested from the transport when zero.
+         */
+        uint32_t bitrate = 0;
+
+        /**
+         * @brief The share of the bus time for the commands, the rest is left for the telemetry and the heartbeat. Zero disables the pacing.
+         */
+        double command_share = 0.3;
+
+        /**
+         * @brief Scheduling of the receiver thread.
+         */
+        ThreadConfig receiver{.name = "robomaster-rx"};
+
+        /**
+         * @brief Scheduling of the sender thread, and of the reactor thread when the handler creates a private reactor.
+         */
+        ThreadConfig sender{.name = "robomaster-tx"};
+
+        /**
+         * @brief Hand the reassembled messages to a decoder thread, which decodes them and invokes the callback, so a slow
+         * callback never delays the reads of the transport.
+         */
+        bool pipeline = false;
+
+        /**
+         * @brief Scheduling of the decoder thread of the receive pipeline.
+         */
+        ThreadConfig decoder{.name = "robomaster-dec"};
+
+        /**
+         * @brief Lock the memory of the process with mlockall before the threads are started, so the buffers are faulted in
+         * and no page faults occur on the threads later on.
+         */
+        bool lock_memory = false;
+    };
+
     /**
      * @brief This class handles the incoming and outgoing RoboMaster message over the can bus.
      *
      */
     class Handler {
         /**
-         * @brief CanSocket class for the can bus io.
+         * @brief Transport for the frame io, the can bus by default.
          */
-        CANBus can_bus_;
+        std::unique_ptr<Transport> transport_;
+
+        /**
+         * @brief The configuration given on init.
+         */
+        HandlerConfig config_;
 
         /**
          * @brief Thread for reading on the can socket and put valid messages in the receiver queue.
@@ -53,6 +173,26 @@ namespace robomaster {
          */
         std::thread thread_sender_;
 
+        /**
+         * @brief Reactor which multiplexes the transport, the heartbeat timer and the sender queue in reactor mode, possibly shared.
+         */
+        std::shared_ptr<Reactor> reactor_;
+
+        /**
+         * @brief Timerfd of the heartbeat in reactor mode.
+         */
+        int timer_descriptor_;
+
+        /**
+         * @brief Eventfd which is signaled when messages are put into the sender queue in reactor mode.
+         */
+        int event_descriptor_;
+
+        /**
+         * @brief Timerfd which expires when the pacer is ready again in reactor mode.
+         */
+        int pacer_descriptor_;
+
         /**
          * @brief Sender queue for sending messages.
          */
@@ -73,6 +213,205 @@ namespace robomaster {
          */
         std::function<void(const Message&)> state_callback_;
 
+        /**
+         * @brief A command which waits for its acknowledgement.
+         */
+        struct PendingCommand {
+            bool is_pending = false;
+            uint16_t type{}, sequence{};
+            uint8_t command_set{}, command_id{};
+            std::chrono::steady_clock::time_point start, deadline;
+            std::promise<CommandResult> promise;
+        };
+
+        /**
+         * @brief The slots of the commands which wait for their acknowledgement.
+         */
+        std::array<PendingCommand, STD_MAX_PENDING_COMMANDS> commands_;
+
+        /**
+         * @brief Mutex of the pending commands, only taken while commands are pending.
+         */
+        std::mutex commands_mutex_;
+
+        /**
+         * @brief The count of pending commands, checked without the mutex.
+         */
+        std::atomic<size_t> commands_pending_;
+
+        /**
+         * @brief Subscribers of the received messages with valid checksums, invoked on the thread which decodes the messages.
+         */
+        Subscribers<const Message&> message_subscribers_;
+
+        /**
+         * @brief Subscribers of the received frames before the reassembly, invoked on the thread which reads the transport.
+         */
+        Subscribers<const can_frame&, std::chrono::system_clock::time_point> frame_subscribers_;
+
+        /**
+         * @brief Token bucket which shapes the messages of the sender queue to the command share of the bus.
+         */
+        Pacer pacer_;
+
+        /**
+         * @brief A message which was popped from the sender queue.
+         */
+        struct Outgoing {
+            Message message{0x0, std::span<const uint8_t>{}};
+            CommandClass command_class = COMMAND_CLASS_AUXILIARY;
+        };
+
+        /**
+         * @brief The popped messages of the sender which are not sent yet, in the order of sending.
+         */
+        std::array<Outgoing, STD_MAX_BATCH_MESSAGES> messages_sender_;
+
+        /**
+         * @brief The count of messages at the front of messages_sender_ which are not sent yet, they are sent before the queue is popped again.
+         */
+        size_t pending_count_;
+
+        /**
+         * @brief The unsent frames of a message which is partly on the bus, they are sent before any other frame.
+         */
+        std::span<const can_frame> partial_;
+
+        /**
+         * @brief Status if the partial frames belong to a heartbeat.
+         */
+        bool is_partial_heartbeat_;
+
+        /**
+         * @brief The earliest time of the next send after the transport was congested or failed.
+         */
+        std::chrono::steady_clock::time_point retry_time_;
+
+        /**
+         * @brief Status if the sender queue is held back until the next heartbeat, because the pending message would delay it.
+         */
+        bool is_held_;
+
+        /**
+         * @brief Counter for the heartbeat sequence.
+         */
+        uint16_t heartbeat_counter_;
+
+        /**
+         * @brief The precomputed frames of a full cycle of heartbeat messages.
+         */
+        std::vector<can_frame> heartbeat_frames_;
+
+        /**
+         * @brief The absolute deadline of the next userspace heartbeat on CLOCK_MONOTONIC.
+         */
+        std::chrono::steady_clock::time_point heartbeat_deadline_;
+
+        /**
+         * @brief The time of the last sent userspace heartbeat.
+         */
+        std::chrono::steady_clock::time_point heartbeat_last_;
+
+        /**
+         * @brief Status if the transport sends the heartbeat cycle on its own.
+         */
+        bool is_cyclic_;
+
+        /**
+         * @brief The time when the latest heartbeat of the transport started, re-anchored by the echo of its last frame on the bus.
+         */
+        std::atomic<std::chrono::steady_clock::time_point> cyclic_origin_;
+
+        /**
+         * @brief Status if the heartbeat of the transport is echoed, then the window is only opened by the echo of the current heartbeat.
+         */
+        std::atomic<bool> is_cyclic_synced_;
+
+        /**
+         * @brief The time from the first frame of a heartbeat of the transport until its last frame left the bus.
+         */
+        std::chrono::nanoseconds cyclic_span_;
+
+        /**
+         * @brief The earliest time the queued messages can be sent between two heartbeats of the transport.
+         */
+        std::chrono::steady_clock::time_point hold_time_;
+
+        /**
+         * @brief Reusable frame buffer of the sender.
+         */
+        std::vector<can_frame> frames_sender_;
+
+        /**
+         * @brief Preallocated frame buffer of the receiver.
+         */
+        std::array<can_frame, STD_MAX_BATCH_SIZE> frames_receiver_;
+
+        /**
+         * @brief Preallocated receive timestamps of the receiver.
+         */
+        std::array<std::chrono::system_clock::time_point, STD_MAX_BATCH_SIZE> timestamps_receiver_;
+
+        /**
+         * @brief Reassembly of the message streams in the order of the registry.
+         */
+        std::array<StreamParser, Registry::size> parsers_;
+
+        /**
+         * @brief Consecutive send failures.
+         */
+        size_t error_counter_sender_;
+
+        /**
+         * @brief Start of the ongoing congestion of the transport, empty when the last send succeeded.
+         */
+        std::optional<std::chrono::steady_clock::time_point> busy_since_;
+
+        /**
+         * @brief Receive failures.
+         */
+        size_t error_counter_receiver_;
+
+        /**
+         * @brief Statistics of the receiver.
+         */
+        Counter frames_received_, frames_unknown_, read_timeouts_, read_failures_, messages_unmatched_;
+
+        /**
+         * @brief Statistics of the messages per device in the order of the registry.
+         */
+        std::array<DeviceCounters, Registry::size> device_counters_;
+
+        /**
+         * @brief Statistics of the sender, on their own cache line.
+         */
+        alignas(64) Counter messages_sent_, heartbeats_sent_, send_busy_, send_failures_;
+
+        /**
+         * @brief The periods between the userspace heartbeats, recorded by the sender.
+         */
+        Histogram heartbeat_periods_;
+
+        /**
+         * @brief The longest delay of a userspace heartbeat behind its deadline in nanoseconds.
+         */
+        std::atomic<int64_t> heartbeat_lateness_;
+
+        /**
+         * @brief The round-trip times of the acknowledged commands, recorded by the receiving thread.
+         */
+        Histogram command_round_trips_;
+
+        /**
+         * @brief Commands which were not acknowledged before their deadline.
+         */
+        Counter command_timeouts_;
+
+        /**
+         * @brief Messages dropped from the full sender queue, counted by the pushing threads.
+         */
+        alignas(64) Counter queue_overflows_;
+
         /**
          * @brief Status of the initialisation of the handler class. True when the can socket was successfully initialised.
          */
@@ -83,6 +422,16 @@ namespace robomaster {
          */
         std::atomic<bool> is_stopped_;
 
+        /**
+         * @brief Gate which holds the receiver and the sender thread until their scheduling is applied.
+         */
+        std::atomic<bool> is_started_;
+
+        /**
+         * @brief Receive pipeline which decodes the messages on its own thread, empty when disabled. Stopped before the members it uses are destroyed.
+         */
+        std::unique_ptr<Pipeline> pipeline_;
+
         /**
          * @brief Run function of the sender thread.
          */
@@ -94,46 +443,191 @@ namespace robomaster {
         void receiver_thread();
 
         /**
-         * @brief Joining all started threads.
+         * @brief Create the heartbeat timer and the sender event and register them with the transport in the reactor.
+         *
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        bool init_reactor();
+
+        /**
+         * @brief Unregister the descriptors from the reactor, the callbacks are not running anymore after return.
+         */
+        void unregister_reactor();
+
+        /**
+         * @brief Unregister from the reactor, release it and close the descriptors.
+         */
+        void stop_reactor();
+
+        /**
+         * @brief Joining all started threads and stop the receive pipeline.
          */
         void join_all();
 
         /**
-         * @brief Send the message to the can socket.
+         * @brief Split the encoded message into can frames and append them to the given frames.
          *
          * @param message The RoboMaster message.
+         * @param frames The frames where the can frames are appended.
+         */
+        static void encode_frames(const Message& message, std::vector<can_frame>& frames);
+
+        /**
+         * @brief Encode a full cycle of heartbeat messages with the counter and the checksums already set.
+         *
+         * @return std::vector<can_frame> as frames of all heartbeat messages in order.
+         */
+        static std::vector<can_frame> heartbeat_cycle();
+
+        /**
+         * @brief Send the next precomputed heartbeat message, the unsent rest of a partly sent heartbeat is kept as partial frames.
+         *
+         * @return SendStatus of the transport.
+         */
+        [[nodiscard]] SendStatus send_heartbeat();
+
+        /**
+         * @brief Record the period and the lateness of the sent heartbeat and move the deadline to the next period.
+         */
+        void complete_heartbeat();
+
+        /**
+         * @brief Send the partial frames of a message which is partly on the bus.
+         *
+         * @return SendStatus of the transport.
+         */
+        [[nodiscard]] SendStatus send_partial();
+
+        /**
+         * @brief Send what is due without waiting: the partial frames, the userspace heartbeat and the queued messages as far as
+         * the pacer allows. When the transport is congested or fails, nothing is sent until the retry time.
+         *
+         * @param now The current time.
+         */
+        void run_sender(std::chrono::steady_clock::time_point now);
+
+        /**
+         * @brief Move the heartbeat deadline to the next period after the given time, missed periods are skipped.
+         *
+         * @param now The current time.
+         */
+        void advance_heartbeat(std::chrono::steady_clock::time_point now);
+
+        /**
+         * @brief The window between two heartbeats of the transport at the given time, from the end of the current heartbeat
+         * to the start of the next one with a margin on both sides. With echoes the window of the latest echoed heartbeat is returned,
+         * the schedule is only extrapolated when the echoes are missing for two periods. Until the first echo the window is held back
+         * for two periods after the start.
+         *
+         * @param time The time in the period of the window.
+         * @return std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point> as open and close time.
+         */
+        [[nodiscard]] std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point> cyclic_window(std::chrono::steady_clock::time_point time) const;
+
+        /**
+         * @brief Re-anchor the heartbeat schedule of the transport when the frame is the echo of the last frame of a heartbeat.
+         * The transport re-arms its timer relative to the current time, so the schedule drifts and is synchronised on every period.
+         *
+         * @param frame The received frame of the intelli controller.
+         * @param timestamp The time the frame was received.
+         */
+        void sync_cyclic(const can_frame& frame, std::chrono::system_clock::time_point timestamp);
+
+        /**
+         * @brief True when partial frames, a pending message or the sender queue has messages to send.
+         *
+         * @return true, when messages are queued.
+         */
+        [[nodiscard]] bool has_queued() const;
+
+        /**
+         * @brief Drain up to a batch of messages from the sender queue, as far as the pacer allows, and send all of their frames at once.
+         * A message whose frames would still be on the bus at the guard time before the next heartbeat is kept pending until the heartbeat is sent.
+         * When the transport sends the heartbeat, a message is kept pending until it fits into the window between two heartbeats.
+         * A pending message of a lane which keeps only the newest message is dropped once a newer message of the lane is queued.
+         * When the transport is congested the unsent frames of a partly sent message become the partial frames and the unsent messages stay pending.
+         *
+         * @return SendStatus of the transport, SEND_STATUS_SENT when the queue is empty.
+         */
+        [[nodiscard]] SendStatus send_queued();
+
+        /**
+         * @brief Count the send failures. Congestion of the transport is no failure unless it lasts longer than a second.
+         *
+         * @param status The status of the send.
+         * @return true, when the frames are sent.
+         * @return false, when the transport was congested or failed.
+         */
+        bool account_send(SendStatus status);
+
+        /**
+         * @brief Read a batch of frames from the transport and reassemble them into messages.
+         *
          * @return true, by success.
-         * @return false, by failing to send the message.
+         * @return false, by failing to read the frames.
+         */
+        [[nodiscard]] bool receive_frames();
+
+        /**
+         * @brief Complete the pending command which the message acknowledges.
+         *
+         * @param message The received message.
+         * @return true, when the message is the acknowledgement of a pending command.
          */
-        [[nodiscard]] bool send_message(const Message& message) const;
+        bool acknowledge_command(const Message& message);
+
+        /**
+         * @brief Complete the pending commands whose deadline has passed.
+         *
+         * @param now The current time, the maximum to complete all.
+         * @param status The status of the completed commands.
+         */
+        void expire_commands(std::chrono::steady_clock::time_point now, CommandStatus status = COMMAND_STATUS_TIMEOUT);
+
+        /**
+         * @brief Decode a message of the receive pipeline on the decoder thread and process it.
+         *
+         * @param raw The reassembled message.
+         */
+        void decode_message(const RawMessage& raw);
 
         /**
          * @brief Process the received messages from the message queue and triggers callback functions.
          *
+         * @param index The index of the route of the device in the registry.
          * @param message RoboMaster message.
          */
-        void receive_message(const Message& message) const;
+        void receive_message(size_t index, const Message& message);
 
     public:
         /**
-         * @brief Construct a new Handler object.
+         * @brief Construct a new Handler object which uses the can bus.
          *
          */
         Handler();
 
+        /**
+         * @brief Construct a new Handler object which uses the given transport.
+         *
+         * @param transport The transport for the frame io.
+         */
+        explicit Handler(std::unique_ptr<Transport> transport);
+
         /**
          * @brief Destroy the Handler object and stop the threads.
          */
         ~Handler();
 
         /**
-         * @brief Init the can socket and start the threads.
+         * @brief Init the transport and start the threads.
          *
-         * @param interface The can interface name.
+         * @param interface The can interface name or the name of the transport.
+         * @param config The configuration of the handler.
          * @return true, when successful initialised.
          * @return false, by failing the initialisation.
          */
-        bool init(const std::string& interface="can0");
+        bool init(const std::string& interface="can0", const HandlerConfig& config = HandlerConfig{});
 
         /**
          * @brief State if the handler is running or not.
@@ -147,8 +641,28 @@ namespace robomaster {
          * @brief Push a message to the sender queue to send it over the can bus.
          *
          * @param message A RoboMaster message.
+         * @param command_class The command class which sets the priority of the message.
+         */
+        void push_message(const Message& message, CommandClass command_class = COMMAND_CLASS_AUXILIARY);
+
+        /**
+         * @brief Push a command which requests an acknowledgement and track its reply. The reply is matched by the swapped sender
+         * and receiver, the sequence and the command id. The deadlines are checked every heartbeat period.
+         *
+         * @param message A RoboMaster message whose attribute requests an acknowledgement, with a unique sequence.
+         * @param command_class The command class which sets the priority of the message.
+         * @param timeout The time to wait for the acknowledgement.
+         * @return std::future<CommandResult> which is ready with the reply, after the timeout, at once when too many commands
+         * are pending (the command is still sent) or when the handler stops.
+         */
+        std::future<CommandResult> push_command(const Message& message, CommandClass command_class, std::chrono::milliseconds timeout = STD_COMMAND_TIMEOUT);
+
+        /**
+         * @brief Take a snapshot of the statistics of the link, can be called from any thread without locking.
+         *
+         * @return HandlerStats as snapshot.
          */
-        void push_message(const Message& message);
+        [[nodiscard]] HandlerStats stats() const;
 
         /**
          * @brief Bind the given callback for triggering when the message for the RoboMasterState is received.
@@ -156,5 +670,41 @@ namespace robomaster {
          * @param completion The callback to trigger.
          */
         void set_callback(std::function<void(const Message&)> completion);
+
+        /**
+         * @brief Subscribe to the received messages with valid checksums, the filter is applied before the callback is invoked.
+         * The callback runs on the receiving thread, or on the decoder thread with the receive pipeline, and must not block.
+         *
+         * @param callback The callback with the message.
+         * @param device_id The can device id to match, zero for all devices.
+         * @param type The message type to match, zero for all types.
+         * @return size_t as id of the subscription, STD_MAX_SUBSCRIBERS when all subscriber slots are in use.
+         */
+        size_t subscribe(std::function<void(const Message&)> callback, uint32_t device_id = 0x0, uint16_t type = 0x0);
+
+        /**
+         * @brief Subscribe to the received can frames before the reassembly, the callback runs on the thread which reads the transport.
+         *
+         * @param callback The callback with the frame and its receive time.
+         * @param device_id The can device id to match, zero for all devices.
+         * @return size_t as id of the subscription, STD_MAX_SUBSCRIBERS when all subscriber slots are in use.
+         */
+        size_t subscribe_frames(std::function<void(const can_frame&, std::chrono::system_clock::time_point)> callback, uint32_t device_id = 0x0);
+
+        /**
+         * @brief Remove a message subscription, can be called at any time. The callback is not running anymore after return.
+         *
+         * @param subscription The id of the subscription.
+         * @return true, by success, false, when the subscription is unknown.
+         */
+        bool unsubscribe(size_t subscription);
+
+        /**
+         * @brief Remove a frame subscription, can be called at any time. The callback is not running anymore after return.
+         *
+         * @param subscription The id of the subscription.
+         * @return true, by success, false, when the subscription is unknown.
+         */
+        bool unsubscribe_frames(size_t subscription);
     };
-} // namespace robomaster
\ No newline at end of file
+} // namespace robomaster
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "transport.h"
+#include "ring.h"
+
+namespace robomaster {
+    /**
+     * @brief In-process transport without syscalls. Two connected ends pass frames through lock-free rings,
+     * each end must be written by one thread and read by one thread.
+     */
+    class LoopbackBus final : public Transport {
+        /**
+         * @brief A frame in flight with the timestamp when it was sent.
+         */
+        struct Frame {
+            can_frame frame;
+            std::chrono::system_clock::time_point timestamp;
+        };
+
+        /**
+         * @brief The rings which connect both ends, one per direction, with an optional eventfd per reading end.
+         */
+        struct Channel {
+            SPSCRing<Frame, 1024> rings[2];
+            std::atomic<int> events[2] = { -1, -1 };
+            ~Channel();
+        };
+
+        /**
+         * @brief The shared channel of both ends.
+         */
+        std::shared_ptr<Channel> channel_;
+
+        /**
+         * @brief The side of the channel, this end reads from rings[side] and writes to the other ring.
+         */
+        size_t side_;
+
+        /**
+         * @brief The device ids to receive, all frames are received when empty.
+         */
+        std::vector<uint32_t> filter_;
+
+        /**
+         * @brief The read timeout.
+         */
+        std::chrono::microseconds timeout_;
+
+        /**
+         * @brief Construct one end of the channel.
+         *
+         * @param channel The shared channel.
+         * @param side The side of this end.
+         */
+        LoopbackBus(std::shared_ptr<Channel> channel, size_t side);
+
+    public:
+        /**
+         * @brief Create two connected ends, frames sent on one end are read on the other end.
+         *
+         * @return The two ends.
+         */
+        static std::pair<std::unique_ptr<LoopbackBus>, std::unique_ptr<LoopbackBus>> create_pair();
+
+        /**
+         * @brief Destructor of the LoopbackBus class.
+         */
+        ~LoopbackBus() override = default;
+
+        /**
+         * @brief Nothing to open, the ends are connected on creation.
+         *
+         * @param interface Unused.
+         * @return true.
+         */
+        bool init(const std::string& interface) override;
+
+        /**
+         * @brief Set the timeout for reading frames, a timeout of zero reads the available frames without blocking.
+         *
+         * @param seconds Double in seconds.
+         */
+        void set_timeout(double seconds) override;
+
+        /**
+         * @brief Receive only standard frames of the given device ids.
+         *
+         * @param device_ids The device ids to receive.
+         * @return true.
+         */
+        [[nodiscard]] bool set_filter(std::span<const uint32_t> device_ids) override;
+
+        /**
+         * @brief Get an eventfd which is signaled when the other end sends frames, it is created on the first call.
+         * Without the eventfd no syscall is made at all.
+         *
+         * @return int as file descriptor, -1 when the eventfd could not be created.
+         */
+        [[nodiscard]] int get_descriptor() override;
+
+        using Transport::send_frames;
+
+        /**
+         * @brief Send the can frames to the other end.
+         *
+         * @param frames The can frames to send.
+         * @param sent The count of frames from the front which are sent.
+         * @return SEND_STATUS_SENT, when all frames are sent.
+         * @return SEND_STATUS_BUSY, when the ring of the other end is full.
+         */
+        SendStatus send_frames(std::span<const can_frame> frames, size_t& sent) override;
+
+        /**
+         * @brief Read the frames sent by the other end, polling until at least one frame is received or the timeout is reached.
+         *
+         * @param frames The buffer for the received can frames.
+         * @param timestamps The send timestamps of the frames, must be at least as large as frames.
+         * @param count The count of received frames, zero when the timeout is reached.
+         * @return true, always.
+         */
+        bool read_frames(std::span<can_frame> frames, std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) override;
+    };
+} // namespace robomaster
@@ -23,11 +23,28 @@
  */
 
 #pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace robomaster {
+    /**
+     * @brief The maximal length of a RoboMaster message, the length field of the header is a single byte.
+     */
+    static constexpr size_t STD_MAX_MESSAGE_LENGTH = 256;
+
+    /**
+     * @brief The maximal length of the payload, the longest message minus the header, type, sequence and crc.
+     */
+    static constexpr size_t STD_MAX_PAYLOAD_LENGTH = STD_MAX_MESSAGE_LENGTH - 11;
+
     /**
      * @brief This class defined a RoboMaster message. The information values in the messages are saved in little endian.
+     * The payload is stored inline, so the message is trivially copyable and never allocates.
      */
     class Message {
         /**
@@ -51,9 +68,24 @@ namespace robomaster {
         uint16_t type_;
 
         /**
-         * @brief The payload of the message which contains the information.
+         * @brief The length of the payload.
+         */
+        uint8_t length_;
+
+        /**
+         * @brief The payload of the message which contains the information, valid up to the length.
+         */
+        std::array<uint8_t, STD_MAX_PAYLOAD_LENGTH> payload_;
+
+        /**
+         * @brief The kernel receive timestamp of the first can frame of the message.
+         */
+        std::chrono::system_clock::time_point first_timestamp_;
+
+        /**
+         * @brief The kernel receive timestamp of the last can frame of the message.
          */
-        std::vector<uint8_t> payload_;
+        std::chrono::system_clock::time_point last_timestamp_;
 
     public:
         /**
@@ -62,7 +94,17 @@ namespace robomaster {
          * @param device_id The can device id.
          * @param message_data The raw data for example can bus to parse into a RoboMaster message.
          */
-        Message(uint32_t device_id, const std::vector<uint8_t>& message_data);
+        Message(uint32_t device_id, std::span<const uint8_t> message_data);
+
+        /**
+         * @brief Construct a new Message object.
+         *
+         * @param device_id The can device id.
+         * @param device_type The device type.
+         * @param sequence The current sequence.
+         * @param payload The payload for the information, truncated to STD_MAX_PAYLOAD_LENGTH.
+         */
+        Message(uint32_t device_id, uint16_t device_type, uint16_t sequence, std::span<const uint8_t> payload = {});
 
         /**
          * @brief Construct a new Message object.
@@ -70,9 +112,9 @@ namespace robomaster {
          * @param device_id The can device id.
          * @param device_type The device type.
          * @param sequence The current sequence.
-         * @param payload The payload for the information.
+         * @param payload The payload for the information, truncated to STD_MAX_PAYLOAD_LENGTH.
          */
-        Message(uint32_t device_id, uint16_t device_type, uint16_t sequence, std::vector<uint8_t> payload=std::vector<uint8_t>());
+        Message(uint32_t device_id, uint16_t device_type, uint16_t sequence, std::initializer_list<uint8_t> payload);
 
         /**
          * @brief Destructor of the Message class.
@@ -111,9 +153,9 @@ namespace robomaster {
         /**
          * @brief Get the payload from the message.
          *
-         * @return std::vector<uint8_t> as payload.
+         * @return std::span<const uint8_t> as payload, valid as long as the message.
          */
-        [[nodiscard]] std::vector<uint8_t> get_payload() const;
+        [[nodiscard]] std::span<const uint8_t> get_payload() const;
 
         /**
          * @brief Get the complete length from the message including header, crc and payload.
@@ -122,12 +164,34 @@ namespace robomaster {
          */
         [[nodiscard]] size_t get_length() const;
 
+        /**
+         * @brief Get the kernel receive timestamp of the first can frame, this is the acquisition time of the message.
+         *
+         * @return std::chrono::system_clock::time_point as timestamp, epoch when the message was not received.
+         */
+        [[nodiscard]] std::chrono::system_clock::time_point get_first_timestamp() const;
+
+        /**
+         * @brief Get the kernel receive timestamp of the last can frame, this is the time when the message was complete.
+         *
+         * @return std::chrono::system_clock::time_point as timestamp, epoch when the message was not received.
+         */
+        [[nodiscard]] std::chrono::system_clock::time_point get_last_timestamp() const;
+
+        /**
+         * @brief Set the kernel receive timestamps of the first and last can frame.
+         *
+         * @param first The timestamp of the first can frame.
+         * @param last The timestamp of the last can frame.
+         */
+        void set_timestamps(std::chrono::system_clock::time_point first, std::chrono::system_clock::time_point last);
+
         /**
          * @brief Set the payload.
          *
-         * @param payload The payload.
+         * @param payload The payload, truncated to STD_MAX_PAYLOAD_LENGTH.
          */
-        void set_payload(const std::vector<uint8_t>& payload);
+        void set_payload(std::span<const uint8_t> payload);
 
         /**
          * @brief Set the type.
@@ -248,6 +312,14 @@ namespace robomaster {
          */
         [[nodiscard]] float get_float(size_t index) const;
 
+        /**
+         * @brief Encode the raw data of the message including header, crc and payload into the given buffer.
+         *
+         * @param buffer The buffer for the raw data, a buffer of STD_MAX_MESSAGE_LENGTH fits every message.
+         * @return size_t as length of the raw data, zero when the message is not valid or the buffer is too short.
+         */
+        size_t encode(std::span<uint8_t> buffer) const;
+
         /**
          * @brief Create a vector as raw data from the message including header, crc and payload.
          *
@@ -255,4 +327,6 @@ namespace robomaster {
          */
         [[nodiscard]] std::vector<uint8_t> vector() const;
     };
+
+    static_assert(std::is_trivially_copyable_v<Message>);
 } // namespace robomaster
\ No newline at end of file
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <linux/can.h>
+#include <chrono>
+#include <cstdint>
+#include <span>
+
+namespace robomaster {
+    /**
+     * @brief The bitrate of the RoboMaster can bus, assumed when the transport does not know it.
+     */
+    static constexpr uint32_t STD_DEFAULT_BITRATE = 1000000;
+
+    /**
+     * @brief Token bucket which shapes the sent frames to a share of the bus time. The bucket holds bus time and is kept
+     * as the time when it is full again, so frames pass at once up to the depth of the bucket and are spread after it.
+     */
+    class Pacer {
+        /**
+         * @brief The time of a bit on the bus in nanoseconds.
+         */
+        double bit_time_;
+
+        /**
+         * @brief The share of the bus time for the paced frames, zero when the pacing is disabled.
+         */
+        double share_;
+
+        /**
+         * @brief The depth of the bucket.
+         */
+        std::chrono::nanoseconds depth_;
+
+        /**
+         * @brief The time when the bucket is full again.
+         */
+        std::chrono::steady_clock::time_point full_;
+
+    public:
+        /**
+         * @brief Constructor of the Pacer class, the pacing is disabled.
+         */
+        Pacer(/* args */);
+
+        /**
+         * @brief Constructor of the Pacer class.
+         *
+         * @param bitrate The bitrate of the bus in bit/s.
+         * @param share The share of the bus time for the paced frames, zero disables the pacing.
+         * @param depth The depth of the bucket.
+         */
+        Pacer(uint32_t bitrate, double share, std::chrono::nanoseconds depth);
+
+        /**
+         * @brief The count of bits of the frame on the bus, including the stuff bits and the interframe space.
+         *
+         * @param frame The can frame.
+         * @return size_t as count of bits.
+         */
+        [[nodiscard]] static size_t frame_bits(const can_frame& frame);
+
+        /**
+         * @brief The time the frames occupy the bus.
+         *
+         * @param frames The can frames.
+         * @return std::chrono::nanoseconds as duration.
+         */
+        [[nodiscard]] std::chrono::nanoseconds bus_time(std::span<const can_frame> frames) const;
+
+        /**
+         * @brief True when frames can be sent at the given time.
+         *
+         * @param now The current time.
+         * @return true, when the bucket is not empty.
+         */
+        [[nodiscard]] bool is_ready(std::chrono::steady_clock::time_point now) const;
+
+        /**
+         * @brief The earliest time when frames can be sent.
+         *
+         * @return std::chrono::steady_clock::time_point as time.
+         */
+        [[nodiscard]] std::chrono::steady_clock::time_point ready_time() const;
+
+        /**
+         * @brief Take the bus time of the sent frames from the bucket.
+         *
+         * @param frames The sent can frames.
+         * @param now The current time.
+         */
+        void consume(std::span<const can_frame> frames, std::chrono::steady_clock::time_point now);
+    };
+} // namespace robomaster
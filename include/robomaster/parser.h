@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+
+#include "message.h"
+#include "stats.h"
+
+namespace robomaster {
+    /**
+     * @brief Streaming reassembly of the RoboMaster messages of one device. The bytes are fed as they arrive,
+     * the header checksum and the length are validated as soon as the header is complete and every message
+     * is assembled in a fixed buffer without heap allocation.
+     */
+    class StreamParser {
+        /**
+         * @brief The bytes of the message in progress, a message always starts at the front.
+         */
+        std::array<uint8_t, STD_MAX_MESSAGE_LENGTH> buffer_;
+
+        /**
+         * @brief The count of bytes of the message in progress.
+         */
+        size_t size_;
+
+        /**
+         * @brief The length of the message in progress, zero until the header is validated.
+         */
+        size_t length_;
+
+        /**
+         * @brief The running CRC16 of the buffered message, updated per received part.
+         */
+        uint16_t crc_;
+
+        /**
+         * @brief The time when the first byte of the message in progress or of the last complete message was received.
+         */
+        std::chrono::system_clock::time_point timestamp_;
+
+        /**
+         * @brief Rejected headers.
+         */
+        Counter header_failures_;
+
+        /**
+         * @brief Messages which are dropped by the CRC16.
+         */
+        Counter checksum_failures_;
+
+        /**
+         * @brief Skipped and dropped bytes.
+         */
+        Counter bytes_discarded_;
+
+        /**
+         * @brief Drop the invalid header and continue with the next start byte inside of it.
+         */
+        void resync();
+
+    public:
+        /**
+         * @brief Constructor of the StreamParser class.
+         */
+        StreamParser(/* args */);
+
+        /**
+         * @brief Consume bytes until a message is complete or all bytes are consumed.
+         *
+         * @param data The received bytes.
+         * @param time The receive time of the bytes.
+         * @param message The complete message with valid checksums, empty when none is complete. Valid until the next call.
+         * @return size_t as count of consumed bytes.
+         */
+        size_t parse(std::span<const uint8_t> data, std::chrono::system_clock::time_point time, std::span<const uint8_t>& message);
+
+        /**
+         * @brief Consume all bytes and trigger the completion for each complete message with valid checksums.
+         *
+         * @param data The received bytes.
+         * @param time The receive time of the bytes.
+         * @param completion Invoked with the message, the time of its first byte and the time of its last byte.
+         */
+        template<typename Completion>
+        void push(std::span<const uint8_t> data, const std::chrono::system_clock::time_point time, Completion&& completion) {
+            while (!data.empty()) {
+                std::span<const uint8_t> message; data = data.subspan(this->parse(data, time, message));
+                if (!message.empty()) { completion(message, this->timestamp_, time); }
+            }
+        }
+
+        /**
+         * @brief Drop the message in progress.
+         */
+        void reset();
+
+        /**
+         * @brief Take a snapshot of the statistics, can be called from any thread.
+         *
+         * @return ParserStats as snapshot.
+         */
+        [[nodiscard]] ParserStats stats() const;
+    };
+} // namespace robomaster
@@ -23,6 +23,7 @@
  */
 
 #pragma once
+#include <array>
 #include <vector>
 #include <cstdint>
 
@@ -48,23 +49,23 @@ namespace robomaster {
         /**
          * @brief The Device ID's.
          */
-        static const uint16_t DEVICE_ID_INTELLI_CONTROLLER;
-        static const uint16_t DEVICE_ID_MOTION_CONTROLLER;
-        static const uint16_t DEVICE_ID_GIMBAL;
-        static const uint16_t DEVICE_ID_HIT_DETECTOR_1;
-        static const uint16_t DEVICE_ID_HIT_DETECTOR_2;
-        static const uint16_t DEVICE_ID_HIT_DETECTOR_3;
-        static const uint16_t DEVICE_ID_HIT_DETECTOR_4;
+        static constexpr uint16_t DEVICE_ID_INTELLI_CONTROLLER = 0x201;
+        static constexpr uint16_t DEVICE_ID_MOTION_CONTROLLER = 0x202;
+        static constexpr uint16_t DEVICE_ID_GIMBAL = 0x203;
+        static constexpr uint16_t DEVICE_ID_HIT_DETECTOR_1 = 0x211;
+        static constexpr uint16_t DEVICE_ID_HIT_DETECTOR_2 = 0x212;
+        static constexpr uint16_t DEVICE_ID_HIT_DETECTOR_3 = 0x213;
+        static constexpr uint16_t DEVICE_ID_HIT_DETECTOR_4 = 0x214;
 
         /**
          * @brief The Message Type's.
          */
-        static const uint16_t DEVICE_RC_TYPE_MOTION_CONTROLLER;
-        static const uint16_t DEVICE_RC_TYPE_GIMBAL;
-        static const uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_1;
-        static const uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_2;
-        static const uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_3;
-        static const uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_4;
+        static constexpr uint16_t DEVICE_RC_TYPE_MOTION_CONTROLLER = 0x0903;
+        static constexpr uint16_t DEVICE_RC_TYPE_GIMBAL = 0x0904;
+        static constexpr uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_1 = 0x0938;
+        static constexpr uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_2 = 0x0958;
+        static constexpr uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_3 = 0x0978;
+        static constexpr uint16_t DEVICE_RC_TYPE_HIT_DETECTOR_4 = 0x0998;
 
         /**
          * @brief The boot payload data.
@@ -113,12 +114,12 @@ namespace robomaster {
         /**
          * @brief The message payload data.
          */
-        static const std::vector<uint8_t> MESSAGE_MOTION_CONTROLLER;
-        static const std::vector<uint8_t> MESSAGE_GIMBAL;
-        static const std::vector<uint8_t> MESSAGE_HIT_DETECTOR_1;
-        static const std::vector<uint8_t> MESSAGE_HIT_DETECTOR_2;
-        static const std::vector<uint8_t> MESSAGE_HIT_DETECTOR_3;
-        static const std::vector<uint8_t> MESSAGE_HIT_DETECTOR_4;
+        static constexpr std::array MESSAGE_MOTION_CONTROLLER = std::to_array<uint8_t>({ 0x20, 0x48, 0x08, 0x00 });
+        static constexpr std::array MESSAGE_GIMBAL = std::to_array<uint8_t>({ 0x00, 0x3f, 0x76 });
+        static constexpr std::array MESSAGE_HIT_DETECTOR_1 = std::to_array<uint8_t>({ 0x00, 0x3f, 0x02, 0x10 });
+        static constexpr std::array MESSAGE_HIT_DETECTOR_2 = std::to_array<uint8_t>({ 0x00, 0x3f, 0x02, 0x20 });
+        static constexpr std::array MESSAGE_HIT_DETECTOR_3 = std::to_array<uint8_t>({ 0x00, 0x3f, 0x02, 0x30 });
+        static constexpr std::array MESSAGE_HIT_DETECTOR_4 = std::to_array<uint8_t>({ 0x00, 0x3f, 0x02, 0x40 });
 
     public:
         /**
@@ -137,8 +138,13 @@ namespace robomaster {
         friend class RoboMaster;
 
         /**
-         * @brief Friend class RoboMaster.
+         * @brief Friend class Handler.
          */
         friend class Handler;
+
+        /**
+         * @brief Friend class Registry.
+         */
+        friend class Registry;
     };
 } // namespace robomaster
\ No newline at end of file
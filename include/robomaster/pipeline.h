@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <thread>
+
+#include "ring.h"
+#include "parser.h"
+#include "stats.h"
+#include "scheduling.h"
+
+namespace robomaster {
+    /**
+     * @brief The count of reassembled messages which can wait for the decoder, must be a power of two.
+     */
+    static constexpr size_t STD_PIPELINE_CAPACITY = 128;
+
+    /**
+     * @brief A reassembled message with valid checksums as it is handed from the io thread to the decoder.
+     */
+    struct RawMessage {
+        /**
+         * @brief The index of the route of the device in the registry.
+         */
+        size_t index;
+
+        /**
+         * @brief The can device id.
+         */
+        uint32_t device_id;
+
+        /**
+         * @brief The length of the message.
+         */
+        size_t length;
+
+        /**
+         * @brief The time of the first and of the last frame of the message.
+         */
+        std::chrono::system_clock::time_point first, last;
+
+        /**
+         * @brief The bytes of the message.
+         */
+        std::array<uint8_t, STD_MAX_MESSAGE_LENGTH> data;
+    };
+
+    /**
+     * @brief This class decouples the decoding and the callbacks from the io thread. The io thread pushes the reassembled messages
+     * into a single producer single consumer ring without blocking and a decoder thread, which sleeps on an atomic wait, dispatches them.
+     */
+    class Pipeline {
+        /**
+         * @brief The messages which wait for the decoder.
+         */
+        SPSCRing<RawMessage, STD_PIPELINE_CAPACITY> ring_;
+
+        /**
+         * @brief Counter of the pushes, the decoder waits on it when the ring is empty.
+         */
+        alignas(64) std::atomic<uint32_t> sequence_;
+
+        /**
+         * @brief The highest count of waiting messages, written by the io thread.
+         */
+        std::atomic<size_t> max_depth_;
+
+        /**
+         * @brief Messages dropped from the full ring.
+         */
+        Counter messages_dropped_;
+
+        /**
+         * @brief The consumer of the messages on the decoder thread.
+         */
+        std::function<void(const RawMessage&)> consumer_;
+
+        /**
+         * @brief The decoder thread.
+         */
+        std::thread thread_;
+
+        /**
+         * @brief Status if the decoder thread is stopped.
+         */
+        std::atomic<bool> is_stopped_;
+
+        /**
+         * @brief Run function of the decoder thread.
+         */
+        void run();
+
+    public:
+        /**
+         * @brief Constructor of the Pipeline class.
+         */
+        Pipeline(/* args */);
+
+        /**
+         * @brief Destructor of the Pipeline class, stops the decoder thread.
+         */
+        ~Pipeline();
+
+        /**
+         * @brief Start the decoder thread.
+         *
+         * @param consumer Invoked on the decoder thread with every message in the order of the pushes.
+         * @param config The scheduling of the decoder thread.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        bool init(std::function<void(const RawMessage&)> consumer, const ThreadConfig& config = ThreadConfig{.name = "robomaster-dec"});
+
+        /**
+         * @brief Hand a message to the decoder, never blocks. Only one thread may push.
+         *
+         * @param index The index of the route of the device in the registry.
+         * @param device_id The can device id.
+         * @param data The bytes of the message.
+         * @param first The time of the first frame.
+         * @param last The time of the last frame.
+         * @return true, by success, false, when the ring is full and the message is dropped.
+         */
+        bool push(size_t index, uint32_t device_id, std::span<const uint8_t> data, std::chrono::system_clock::time_point first, std::chrono::system_clock::time_point last);
+
+        /**
+         * @brief Dispatch the waiting messages and stop and join the decoder thread.
+         */
+        void stop();
+
+        /**
+         * @brief Take a snapshot of the statistics, can be called from any thread.
+         *
+         * @return PipelineStats as snapshot.
+         */
+        [[nodiscard]] PipelineStats stats() const;
+    };
+} // namespace robomaster
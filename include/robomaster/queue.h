@@ -23,25 +23,32 @@
  */
 
 #pragma once
-#include <mutex>
-#include <queue>
+#include <array>
 
 #include "message.h"
+#include "ring.h"
+#include "definitions.h"
 
 namespace robomaster {
     /**
-     * @brief This class is queue for RoboMaster messages which is protected by a mutex.
+     * @brief The maximal count of messages per command class.
      */
-    class Queue {
-        /**
-         * @brief The message queue.
-         */
-        std::queue<Message> queue_;
+    static constexpr size_t STD_MAX_QUEUE_SIZE = 16;
 
+    /**
+     * @brief The default count of messages per command class, the setpoint classes keep only the newest message.
+     */
+    static constexpr std::array<size_t, COMMAND_CLASS_COUNT> STD_QUEUE_CAPACITY = { 10, 10, 1, 1, 10, 1, 10 };
+
+    /**
+     * @brief This class is a lock-free queue for RoboMaster messages which can be pushed from many threads.
+     * Every command class has its own lane and the lanes are popped in the order of their priority.
+     */
+    class Queue {
         /**
-         * @brief The mutex to protect the critical section.
+         * @brief The rings of preallocated message slots in the order of the command classes.
          */
-        std::mutex mutex_;
+        std::array<MPMCRing<Message, STD_MAX_QUEUE_SIZE>, COMMAND_CLASS_COUNT> lanes_;
 
     public:
         /**
@@ -55,18 +62,26 @@ namespace robomaster {
         ~Queue() = default;
 
         /**
-         * @brief The current size of the queue.
+         * @brief Drop all messages and set the capacity of the lanes, must not run concurrently with any other call.
+         * A lane with a capacity of one keeps only the newest message.
+         *
+         * @param capacity The count of messages per command class, clamped to one up to STD_MAX_QUEUE_SIZE.
+         */
+        void set_capacity(const std::array<size_t, COMMAND_CLASS_COUNT>& capacity);
+
+        /**
+         * @brief The current size of all lanes of the queue.
          *
          * @return size_t as size.
          */
-        size_t size();
+        [[nodiscard]] size_t size() const;
 
         /**
          * @brief True when the queue is empty.
          *
          * @return true, when empty, false, when not empty.
          */
-        bool empty();
+        [[nodiscard]] bool empty() const;
 
         /**
          * @brief Clear all RoboMaster messages from the queue.
@@ -74,17 +89,46 @@ namespace robomaster {
         void clear();
 
         /**
-         * @brief Pop and return the message of the queue. If the queue is empty an empty message is returned.
+         * @brief Pop and return the message with the highest priority. If the queue is empty an empty message is returned.
          *
          * @return RoboMaster message.
          */
         Message pop();
 
         /**
-         * @brief Push a Message into the queue. If the maximal queue size is reached the front message will be pop.
+         * @brief Pop the message with the highest priority into the given message.
+         *
+         * @param message The popped RoboMaster message.
+         * @return true, by success, false, when the queue is empty.
+         */
+        bool pop(Message& message);
+
+        /**
+         * @brief Pop the message with the highest priority into the given message and its command class.
+         *
+         * @param message The popped RoboMaster message.
+         * @param command_class The command class of the popped message.
+         * @return true, by success, false, when the queue is empty.
+         */
+        bool pop(Message& message, CommandClass& command_class);
+
+        /**
+         * @brief True when the lane of the command class keeps only the newest message and holds one, so an already popped
+         * message of this command class is outdated.
+         *
+         * @param command_class The command class.
+         * @return true, when superseded, false, when not superseded.
+         */
+        [[nodiscard]] bool is_superseded(CommandClass command_class) const;
+
+        /**
+         * @brief Push a Message into the lane of its command class. If the lane is full its front message will be pop.
          *
          * @param message A RoboMaster message.
+         * @param command_class The command class of the message.
+         * @return true, when no message was dropped or the message replaced the one of a lane with a capacity of one,
+         * false, when the front message was dropped.
          */
-        void push(const Message& message);
+        bool push(const Message& message, CommandClass command_class = COMMAND_CLASS_AUXILIARY);
     };
 } // namespace robomaster
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "scheduling.h"
+
+namespace robomaster {
+    /**
+     * @brief This class multiplexes file descriptors with epoll on a single thread and dispatches their readiness to callbacks.
+     */
+    class Reactor {
+        /**
+         * @brief The epoll instance.
+         */
+        int epoll_;
+
+        /**
+         * @brief Eventfd to wake the reactor thread for stopping.
+         */
+        int event_;
+
+        /**
+         * @brief The reactor thread.
+         */
+        std::thread thread_;
+
+        /**
+         * @brief Mutex which is held while callbacks are dispatched and while callbacks are added or removed.
+         */
+        std::mutex mutex_;
+
+        /**
+         * @brief The registered callbacks by file descriptor.
+         */
+        std::map<int, std::function<void(uint32_t)>> callbacks_;
+
+        /**
+         * @brief File descriptors which are removed from a callback and erased after the dispatch.
+         */
+        std::vector<int> removed_;
+
+        /**
+         * @brief Status if the reactor thread is stopped.
+         */
+        std::atomic<bool> is_stopped_;
+
+        /**
+         * @brief Run function of the reactor thread.
+         */
+        void run();
+
+    public:
+        /**
+         * @brief Constructor of the Reactor class.
+         */
+        Reactor(/* args */);
+
+        /**
+         * @brief Destructor of the Reactor class, stops the reactor thread.
+         */
+        ~Reactor();
+
+        /**
+         * @brief Create the epoll instance and start the reactor thread.
+         *
+         * @param config The scheduling of the reactor thread.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        bool init(const ThreadConfig& config = ThreadConfig{.name = "robomaster-io"});
+
+        /**
+         * @brief Register a file descriptor, the callback is invoked on the reactor thread when it is readable.
+         *
+         * @param descriptor The file descriptor.
+         * @param callback The callback with the epoll events.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        bool add(int descriptor, std::function<void(uint32_t)> callback);
+
+        /**
+         * @brief Unregister a file descriptor. When called from another thread, the callback is not running anymore after return.
+         *
+         * @param descriptor The file descriptor.
+         */
+        void remove(int descriptor);
+
+        /**
+         * @brief Stop and join the reactor thread, returns immediately when called from the reactor thread.
+         */
+        void stop();
+    };
+} // namespace robomaster
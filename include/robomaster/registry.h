@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "data.h"
+#include "message.h"
+#include "payload.h"
+
+namespace robomaster {
+    /**
+     * @brief A message which is received from a device and the decoder which writes it into its slot of the RoboMasterState.
+     */
+    struct Route {
+        /**
+         * @brief The can device id of the sender.
+         */
+        uint32_t device_id;
+
+        /**
+         * @brief The message type.
+         */
+        uint16_t type;
+
+        /**
+         * @brief The first bytes of the payload which identify the message.
+         */
+        std::span<const uint8_t> prefix;
+
+        /**
+         * @brief Decode the message into the state.
+         */
+        void (*decode)(const Message& message, RoboMasterState& state);
+    };
+
+    /**
+     * @brief Compile-time registry of all received messages. Adding a device is one route,
+     * the device ids of the filter, the reassembly and the dispatch table are derived from it.
+     */
+    class Registry {
+        /**
+         * @brief The routes, one per device.
+         */
+        static constexpr std::array routes_ = {
+            Route{ Payload::DEVICE_ID_MOTION_CONTROLLER, Payload::DEVICE_RC_TYPE_MOTION_CONTROLLER, Payload::MESSAGE_MOTION_CONTROLLER, [](const Message& message, RoboMasterState& state) {
+                state.velocity = decode_velocity(27, message); state.battery = decode_battery(51, message); state.esc = decode_esc(61, message);
+                state.imu = decode_imu(97, message); state.attitude = decode_attitude(121, message); state.position = decode_position(133, message);
+                state.time.motion_controller = message.get_first_timestamp();
+            } },
+            Route{ Payload::DEVICE_ID_GIMBAL, Payload::DEVICE_RC_TYPE_GIMBAL, Payload::MESSAGE_GIMBAL, [](const Message& message, RoboMasterState& state) { state.gimbal = decode_gimbal(5, message); state.time.gimbal = message.get_first_timestamp(); } },
+            Route{ Payload::DEVICE_ID_HIT_DETECTOR_1, Payload::DEVICE_RC_TYPE_HIT_DETECTOR_1, Payload::MESSAGE_HIT_DETECTOR_1, [](const Message& message, RoboMasterState& state) { state.detector[0] = decode_detector(4, message); state.time.detector[0] = message.get_first_timestamp(); } },
+            Route{ Payload::DEVICE_ID_HIT_DETECTOR_2, Payload::DEVICE_RC_TYPE_HIT_DETECTOR_2, Payload::MESSAGE_HIT_DETECTOR_2, [](const Message& message, RoboMasterState& state) { state.detector[1] = decode_detector(4, message); state.time.detector[1] = message.get_first_timestamp(); } },
+            Route{ Payload::DEVICE_ID_HIT_DETECTOR_3, Payload::DEVICE_RC_TYPE_HIT_DETECTOR_3, Payload::MESSAGE_HIT_DETECTOR_3, [](const Message& message, RoboMasterState& state) { state.detector[2] = decode_detector(4, message); state.time.detector[2] = message.get_first_timestamp(); } },
+            Route{ Payload::DEVICE_ID_HIT_DETECTOR_4, Payload::DEVICE_RC_TYPE_HIT_DETECTOR_4, Payload::MESSAGE_HIT_DETECTOR_4, [](const Message& message, RoboMasterState& state) { state.detector[3] = decode_detector(4, message); state.time.detector[3] = message.get_first_timestamp(); } },
+        };
+
+        /**
+         * @brief The lowest device id, the offset of the dispatch table.
+         */
+        static constexpr uint32_t base_ = std::ranges::min(routes_, {}, &Route::device_id).device_id;
+
+        /**
+         * @brief Dense dispatch table from the device id minus the base to the index of the route, the count of routes for unknown ids.
+         */
+        static constexpr auto table_ = [] {
+            std::array<uint8_t, std::ranges::max(routes_, {}, &Route::device_id).device_id - base_ + 1> table{};
+            table.fill(routes_.size()); for (size_t i = 0; i < routes_.size(); i++) { table[routes_[i].device_id - base_] = static_cast<uint8_t>(i); }
+            return table;
+        }();
+
+        static_assert(routes_.size() < 0xff, "the dispatch table stores the index as uint8_t");
+        static_assert(table_.size() <= 0x100, "the device ids are too sparse for a dense dispatch table");
+
+    public:
+        /**
+         * @brief The count of routes.
+         */
+        static constexpr size_t size = routes_.size();
+
+        /**
+         * @brief The device ids of all routes in the order of the routes.
+         */
+        static constexpr auto device_ids = [] { std::array<uint32_t, size> ids{}; std::ranges::transform(routes_, ids.begin(), &Route::device_id); return ids; }();
+
+        /**
+         * @brief Get the index of the route of the given device id.
+         *
+         * @param device_id The can device id.
+         * @return size_t as index of the route, size when the device id is unknown.
+         */
+        static constexpr size_t index(const uint32_t device_id) {
+            const auto offset = device_id - base_; return offset < table_.size() ? table_[offset] : size;
+        }
+
+        /**
+         * @brief Get the route at the given index.
+         *
+         * @param index The index of the route, must be less than size.
+         * @return const Route& as route.
+         */
+        static constexpr const Route& route(const size_t index) {
+            return routes_[index];
+        }
+
+        /**
+         * @brief Check if the message has the type and the payload prefix of the route at the given index.
+         *
+         * @param index The index of the route, must be less than size.
+         * @param message The received message.
+         * @return true, when the message belongs to the route.
+         * @return false, otherwise.
+         */
+        static bool match(size_t index, const Message& message);
+    };
+} // namespace robomaster
@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+#include <atomic>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+#include "transport.h"
+
+namespace robomaster {
+    /**
+     * @brief Transport which replays the frames of a candump log file (candump -L), sent frames are discarded.
+     */
+    class ReplayBus final : public Transport {
+        /**
+         * @brief A recorded frame with the recorded timestamp.
+         */
+        struct Frame {
+            can_frame frame;
+            std::chrono::system_clock::time_point timestamp;
+        };
+
+        /**
+         * @brief The log file.
+         */
+        std::ifstream file_;
+
+        /**
+         * @brief Replay the frames with the recorded timing instead of as fast as possible.
+         */
+        bool realtime_;
+
+        /**
+         * @brief The device ids to receive, all frames are received when empty.
+         */
+        std::vector<uint32_t> filter_;
+
+        /**
+         * @brief The read timeout.
+         */
+        std::chrono::microseconds timeout_;
+
+        /**
+         * @brief The next frame which is parsed but not yet due.
+         */
+        std::optional<Frame> pending_;
+
+        /**
+         * @brief The start of the replay and the timestamp of the first recorded frame for the realtime replay.
+         */
+        std::optional<std::pair<std::chrono::steady_clock::time_point, std::chrono::system_clock::time_point>> origin_;
+
+        /**
+         * @brief Status if all frames of the log file are replayed.
+         */
+        std::atomic<bool> is_finished_;
+
+        /**
+         * @brief Parse the next frame from the log file which passes the filter.
+         *
+         * @return The frame or nothing at the end of the file.
+         */
+        std::optional<Frame> next_frame();
+
+    public:
+        /**
+         * @brief Constructor of the ReplayBus class.
+         *
+         * @param realtime Replay with the recorded timing instead of as fast as possible.
+         */
+        explicit ReplayBus(bool realtime = false);
+
+        /**
+         * @brief Destructor of the ReplayBus class.
+         */
+        ~ReplayBus() override = default;
+
+        /**
+         * @brief Open the log file.
+         *
+         * @param interface The path of the candump log file.
+         * @return true, when the file is open successfully.
+         * @return false, when the file failed to open.
+         */
+        bool init(const std::string& interface) override;
+
+        /**
+         * @brief Set the timeout for reading frames, a timeout of zero reads the available frames without blocking.
+         *
+         * @param seconds Double in seconds.
+         */
+        void set_timeout(double seconds) override;
+
+        /**
+         * @brief Replay only standard frames of the given device ids.
+         *
+         * @param device_ids The device ids to receive.
+         * @return true.
+         */
+        [[nodiscard]] bool set_filter(std::span<const uint32_t> device_ids) override;
+
+        /**
+         * @brief The replay can not be multiplexed.
+         *
+         * @return -1.
+         */
+        [[nodiscard]] int get_descriptor() override;
+
+        using Transport::send_frames;
+
+        /**
+         * @brief Discard the frames.
+         *
+         * @param frames The can frames to send.
+         * @param sent The count of frames, all are discarded.
+         * @return SEND_STATUS_SENT.
+         */
+        SendStatus send_frames(std::span<const can_frame> frames, size_t& sent) override;
+
+        /**
+         * @brief Read the next recorded frames with the recorded timestamps.
+         *
+         * @param frames The buffer for the received can frames.
+         * @param timestamps The recorded timestamps of the frames, must be at least as large as frames.
+         * @param count The count of received frames, zero at the end of the log file after the timeout.
+         * @return true, also at the end of the log file, which is reported like a timeout.
+         */
+        bool read_frames(std::span<can_frame> frames, std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) override;
+
+        /**
+         * @brief True when all frames of the log file are replayed.
+         *
+         * @return true, when finished, false, when frames are left.
+         */
+        [[nodiscard]] bool is_finished() const;
+    };
+} // namespace robomaster
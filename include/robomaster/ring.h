@@ -0,0 +1,266 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace robomaster {
+    /**
+     * @brief Bounded lock-free ring buffer for exactly one producer and one consumer thread.
+     *
+     * @tparam T The trivially copyable element type.
+     * @tparam N The capacity, must be a power of two.
+     */
+    template <typename T, size_t N>
+    class SPSCRing {
+        static_assert(N != 0 && (N & (N - 1)) == 0, "capacity must be a power of two");
+
+        /**
+         * @brief The preallocated elements.
+         */
+        std::array<T, N> buffer_{};
+
+        /**
+         * @brief Read position, only written by the consumer.
+         */
+        alignas(64) std::atomic<size_t> head_{0};
+
+        /**
+         * @brief Write position, only written by the producer.
+         */
+        alignas(64) std::atomic<size_t> tail_{0};
+
+    public:
+        /**
+         * @brief Push a value, called only by the producer.
+         *
+         * @param value The value to push.
+         * @return true, by success, false, when the ring is full.
+         */
+        bool push(const T& value) {
+            const auto tail = this->tail_.load(std::memory_order::relaxed);
+            if (tail - this->head_.load(std::memory_order::acquire) == N) { return false; }
+            this->buffer_[tail & (N - 1)] = value; this->tail_.store(tail + 1, std::memory_order::release);
+            return true;
+        }
+
+        /**
+         * @brief Pop a value, called only by the consumer.
+         *
+         * @param value The popped value.
+         * @return true, by success, false, when the ring is empty.
+         */
+        bool pop(T& value) {
+            const auto head = this->head_.load(std::memory_order::relaxed);
+            if (head == this->tail_.load(std::memory_order::acquire)) { return false; }
+            value = this->buffer_[head & (N - 1)]; this->head_.store(head + 1, std::memory_order::release);
+            return true;
+        }
+
+        /**
+         * @brief The current count of elements, may be outdated when read by a third thread.
+         *
+         * @return size_t as size.
+         */
+        [[nodiscard]] size_t size() const {
+            const auto head = this->head_.load(std::memory_order::acquire);
+            return this->tail_.load(std::memory_order::acquire) - head;
+        }
+
+        /**
+         * @brief True when the ring is empty.
+         *
+         * @return true, when empty, false, when not empty.
+         */
+        [[nodiscard]] bool empty() const {
+            return this->size() == 0;
+        }
+
+        /**
+         * @brief The capacity of the ring.
+         *
+         * @return size_t as capacity.
+         */
+        [[nodiscard]] static constexpr size_t capacity() {
+            return N;
+        }
+    };
+
+    /**
+     * @brief Bounded lock-free ring buffer for any number of producer and consumer threads (Vyukov).
+     * Every slot carries a sequence which tells whether it is free for the producer or filled for the consumer of a position,
+     * so the elements are copied into preallocated slots and a slot keeps its resources between uses. The sequence is twice
+     * the position and odd when filled, which keeps both states apart even with a capacity of one.
+     *
+     * @tparam T The copy assignable element type.
+     * @tparam N The maximal capacity, the count of preallocated slots.
+     */
+    template <typename T, size_t N>
+    class MPMCRing {
+        static_assert(N != 0, "capacity must not be zero");
+
+        /**
+         * @brief A preallocated element with its sequence, on its own cache line.
+         */
+        struct alignas(64) Slot {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        /**
+         * @brief The preallocated slots.
+         */
+        std::array<Slot, N> slots_;
+
+        /**
+         * @brief The capacity in use, at most N.
+         */
+        size_t capacity_{N};
+
+        /**
+         * @brief The next position to write.
+         */
+        alignas(64) std::atomic<size_t> tail_{0};
+
+        /**
+         * @brief The next position to read.
+         */
+        alignas(64) std::atomic<size_t> head_{0};
+
+        /**
+         * @brief Create the slots with their initial sequence and a copy of the given value.
+         */
+        template <size_t... I>
+        static std::array<Slot, N> make_slots(const T& value, std::index_sequence<I...>) {
+            return { Slot{ {I * 2}, value }... };
+        }
+
+        /**
+         * @brief Claim the slot of the next position to read.
+         *
+         * @return Slot* as claimed slot, nullptr when the ring is empty.
+         */
+        Slot* claim(size_t& position) {
+            position = this->head_.load(std::memory_order::relaxed);
+            while (true) {
+                auto& slot = this->slots_[position % this->capacity_]; const auto difference = static_cast<intptr_t>(slot.sequence.load(std::memory_order::acquire) - (position * 2 + 1));
+                if (difference == 0) { if (this->head_.compare_exchange_weak(position, position + 1, std::memory_order::relaxed)) { return &slot; } }
+                else if (difference < 0) { return nullptr; }
+                else { position = this->head_.load(std::memory_order::relaxed); }
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructor of the MPMCRing class.
+         *
+         * @param value The initial value of the slots, for example with reserved resources.
+         */
+        explicit MPMCRing(const T& value = T{}): slots_{make_slots(value, std::make_index_sequence<N>{})} { }
+
+        /**
+         * @brief Drop all values and use the given capacity, must not run concurrently with any other call.
+         *
+         * @param capacity The capacity, clamped to one up to N.
+         */
+        void resize(const size_t capacity) {
+            this->capacity_ = std::clamp<size_t>(capacity, 1, N);
+            for (size_t i = 0; i < N; i++) { this->slots_[i].sequence.store(i * 2, std::memory_order::relaxed); }
+            this->head_.store(0, std::memory_order::relaxed); this->tail_.store(0, std::memory_order::release);
+        }
+
+        /**
+         * @brief Push a value.
+         *
+         * @param value The value to push.
+         * @return true, by success, false, when the ring is full.
+         */
+        bool push(const T& value) {
+            auto position = this->tail_.load(std::memory_order::relaxed);
+            while (true) {
+                auto& slot = this->slots_[position % this->capacity_]; const auto difference = static_cast<intptr_t>(slot.sequence.load(std::memory_order::acquire) - position * 2);
+                if (difference == 0) {
+                    if (!this->tail_.compare_exchange_weak(position, position + 1, std::memory_order::relaxed)) { continue; }
+                    slot.value = value; slot.sequence.store(position * 2 + 1, std::memory_order::release); return true;
+                }
+                if (difference < 0) { return false; }
+                position = this->tail_.load(std::memory_order::relaxed);
+            }
+        }
+
+        /**
+         * @brief Pop a value.
+         *
+         * @param value The popped value, copy assigned so that it keeps its resources.
+         * @return true, by success, false, when the ring is empty.
+         */
+        bool pop(T& value) {
+            size_t position; auto* slot = this->claim(position); if (slot == nullptr) { return false; }
+            value = slot->value; slot->sequence.store((position + this->capacity_) * 2, std::memory_order::release); return true;
+        }
+
+        /**
+         * @brief Drop the oldest value without reading it.
+         *
+         * @return true, by success, false, when the ring is empty.
+         */
+        bool discard() {
+            size_t position; auto* slot = this->claim(position); if (slot == nullptr) { return false; }
+            slot->sequence.store((position + this->capacity_) * 2, std::memory_order::release); return true;
+        }
+
+        /**
+         * @brief The current count of elements, may be outdated when it is returned.
+         *
+         * @return size_t as size.
+         */
+        [[nodiscard]] size_t size() const {
+            const auto head = this->head_.load(std::memory_order::acquire), tail = this->tail_.load(std::memory_order::acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        /**
+         * @brief True when the ring is empty.
+         *
+         * @return true, when empty, false, when not empty.
+         */
+        [[nodiscard]] bool empty() const {
+            return this->size() == 0;
+        }
+
+        /**
+         * @brief The capacity of the ring.
+         *
+         * @return size_t as capacity.
+         */
+        [[nodiscard]] size_t capacity() const {
+            return this->capacity_;
+        }
+    };
+} // namespace robomaster
@@ -43,25 +43,48 @@ namespace robomaster {
         /**
          * @brief Counter for the message sequences.
          */
-        uint16_t sequence_;
+        std::atomic<uint16_t> sequence_;
 
         /**
          * @brief Store for the motion data state
          */
         std::atomic<RoboMasterState> state_;
 
+        /**
+         * @brief Accumulator of the decoded messages, only accessed by the io thread of the handler.
+         */
+        RoboMasterState decoded_state_;
+
         /**
          * @brief The boot sequence to configure the RoboMasterState messages.
+         *
+         * @param timeout The time to wait for the acknowledgements.
+         * @return std::vector<std::future<CommandResult>> as acknowledgements of the messages which request one.
+         */
+        std::vector<std::future<CommandResult>> boot_sequence(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Build the message to set the work mode of the chassis.
          */
-        void boot_sequence();
+        static Message chassis_mode(ChassisMode mode, uint16_t sequence);
 
         /**
-         * @brief Decode the RoboMasterMotionState message
+         * @brief Build the message to set the work mode of the gimbal.
+         */
+        static Message gimbal_mode(GimbalMode mode, uint16_t sequence);
+
+        /**
+         * @brief Build the message to set the hibernate state of the gimbal.
+         */
+        static Message gimbal_hibernate(GimbalHibernate hibernate, uint16_t sequence);
+
+        /**
+         * @brief Decode the RoboMasterMotionState message into the accumulated state of this instance.
          *
          * @param message The RoboMasterMotionState message.
          * @return the current data state
          */
-        static RoboMasterState decode_state(const Message& message);
+        RoboMasterState decode_state(const Message& message);
 
     public:
         /**
@@ -69,6 +92,13 @@ namespace robomaster {
          */
         RoboMaster(/* args */);
 
+        /**
+         * @brief Constructor of the RoboMaster class which uses the given transport instead of the can bus.
+         *
+         * @param transport The transport for the frame io.
+         */
+        explicit RoboMaster(std::unique_ptr<Transport> transport);
+
         /**
          * @brief Destructor of the RoboMaster class.
          */
@@ -77,10 +107,21 @@ namespace robomaster {
         /**
          * @brief Init the RoboMaster can socket to communicate with the motion controller.
          *
-         * @param interface can interface name.
+         * @param interface can interface name or the name of the transport.
+         * @param config The configuration of the handler.
          * @return true, on success, false, if initialization failed.
          */
-        bool init(const std::string& interface="can0");
+        bool init(const std::string& interface="can0", const HandlerConfig& config = HandlerConfig{});
+
+        /**
+         * @brief Initialize the RoboMaster like init and return the acknowledgements of the boot sequence, so the boot can be awaited.
+         *
+         * @param interface can interface name or the name of the transport.
+         * @param config The configuration of the handler.
+         * @param timeout The time to wait for the acknowledgements.
+         * @return std::vector<std::future<CommandResult>> as acknowledgements of the boot sequence, empty if initialization failed.
+         */
+        std::vector<std::future<CommandResult>> init_async(const std::string& interface="can0", const HandlerConfig& config = HandlerConfig{}, std::chrono::milliseconds timeout = STD_COMMAND_TIMEOUT);
 
         /**
          * @brief True when the robomaster is successful initialized and ready to receive and send messages.
@@ -96,6 +137,48 @@ namespace robomaster {
          */
         [[nodiscard]] RoboMasterState get_state() const;
 
+        /**
+         * @brief Take a snapshot of the statistics of the link, can be called from any thread without locking.
+         *
+         * @return HandlerStats as snapshot.
+         */
+        [[nodiscard]] HandlerStats stats() const;
+
+        /**
+         * @brief Subscribe to the received messages with valid checksums, see Handler::subscribe.
+         *
+         * @param callback The callback with the message.
+         * @param device_id The can device id to match, zero for all devices.
+         * @param type The message type to match, zero for all types.
+         * @return size_t as id of the subscription, STD_MAX_SUBSCRIBERS when all subscriber slots are in use.
+         */
+        size_t subscribe(std::function<void(const Message&)> callback, uint32_t device_id = 0x0, uint16_t type = 0x0);
+
+        /**
+         * @brief Subscribe to the received can frames before the reassembly, see Handler::subscribe_frames.
+         *
+         * @param callback The callback with the frame and its receive time.
+         * @param device_id The can device id to match, zero for all devices.
+         * @return size_t as id of the subscription, STD_MAX_SUBSCRIBERS when all subscriber slots are in use.
+         */
+        size_t subscribe_frames(std::function<void(const can_frame&, std::chrono::system_clock::time_point)> callback, uint32_t device_id = 0x0);
+
+        /**
+         * @brief Remove a message subscription, the callback is not running anymore after return.
+         *
+         * @param subscription The id of the subscription.
+         * @return true, by success, false, when the subscription is unknown.
+         */
+        bool unsubscribe(size_t subscription);
+
+        /**
+         * @brief Remove a frame subscription, the callback is not running anymore after return.
+         *
+         * @param subscription The id of the subscription.
+         * @return true, by success, false, when the subscription is unknown.
+         */
+        bool unsubscribe_frames(size_t subscription);
+
         /**
          * @brief Set the work mode of the RoboMaster Chassis.
          *
@@ -103,6 +186,15 @@ namespace robomaster {
          */
         void set_chassis_mode(ChassisMode mode);
 
+        /**
+         * @brief Set the work mode of the RoboMaster Chassis and wait for the acknowledgement.
+         *
+         * @param mode the chassis work mode.
+         * @param timeout The time to wait for the acknowledgement.
+         * @return std::future<CommandResult> which is ready with the acknowledgement or after the timeout.
+         */
+        std::future<CommandResult> set_chassis_mode_async(ChassisMode mode, std::chrono::milliseconds timeout = STD_COMMAND_TIMEOUT);
+
         /**
          * @brief Control each individual wheel of the RoboMaster in rpm.
          *
@@ -138,6 +230,15 @@ namespace robomaster {
          */
         void set_gimbal_mode(GimbalMode mode);
 
+        /**
+         * @brief Set the work mode of the RoboMaster Gimbal and wait for the acknowledgement.
+         *
+         * @param mode the gimbal's work mode.
+         * @param timeout The time to wait for the acknowledgement.
+         * @return std::future<CommandResult> which is ready with the acknowledgement or after the timeout.
+         */
+        std::future<CommandResult> set_gimbal_mode_async(GimbalMode mode, std::chrono::milliseconds timeout = STD_COMMAND_TIMEOUT);
+
         /**
          * @brief Set the hibernate state of the RoboMaster Gimbal.
          *
@@ -145,6 +246,15 @@ namespace robomaster {
          */
         void set_gimbal_hibernate(GimbalHibernate hibernate);
 
+        /**
+         * @brief Set the hibernate state of the RoboMaster Gimbal and wait for the acknowledgement.
+         *
+         * @param hibernate the gimbal's hibernate state (suspend or resume).
+         * @param timeout The time to wait for the acknowledgement.
+         * @return std::future<CommandResult> which is ready with the acknowledgement or after the timeout.
+         */
+        std::future<CommandResult> set_gimbal_hibernate_async(GimbalHibernate hibernate, std::chrono::milliseconds timeout = STD_COMMAND_TIMEOUT);
+
         /**
          * @brief Set the gimbal motion of the RoboMaster.
          *
@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <sched.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace robomaster {
+    /**
+     * @brief Scheduling of a thread of the library.
+     */
+    struct ThreadConfig {
+        /**
+         * @brief The name of the thread, truncated to 15 characters. The name is not changed when empty.
+         */
+        std::string name{};
+
+        /**
+         * @brief The scheduling policy, SCHED_FIFO and SCHED_RR require CAP_SYS_NICE or an RLIMIT_RTPRIO.
+         */
+        int policy = SCHED_OTHER;
+
+        /**
+         * @brief The static priority of SCHED_FIFO and SCHED_RR, from 1 to 99.
+         */
+        int priority = 0;
+
+        /**
+         * @brief The cpus the thread is allowed to run on, all cpus when empty.
+         */
+        std::vector<size_t> cpus{};
+    };
+
+    /**
+     * @brief Apply the name, the scheduling policy and the cpu affinity to a running thread, every failure is printed.
+     *
+     * @param thread The thread.
+     * @param config The configuration of the thread.
+     * @return true, by success.
+     * @return false, when any setting failed.
+     */
+    bool set_thread_config(std::thread& thread, const ThreadConfig& config);
+
+    /**
+     * @brief Lock all current and future pages of the process into memory (mlockall). The current pages are faulted in,
+     * which includes the preallocated buffers, and later mappings like the stacks of new threads are populated when they are mapped.
+     *
+     * @return true, by success.
+     * @return false, when failed, for example without CAP_IPC_LOCK and a sufficient RLIMIT_MEMLOCK.
+     */
+    bool lock_memory();
+} // namespace robomaster
@@ -0,0 +1,395 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "registry.h"
+
+namespace robomaster {
+    /**
+     * @brief Lock-free event counter which can be read from any thread while it is counted.
+     */
+    class Counter {
+        /**
+         * @brief The count.
+         */
+        std::atomic<uint64_t> value_;
+
+    public:
+        /**
+         * @brief Constructor of the Counter class.
+         */
+        Counter(/* args */): value_{} { }
+
+        /**
+         * @brief Count events, only one thread may use this, without a locked instruction.
+         *
+         * @param count The count of events.
+         */
+        void add(const uint64_t count = 1) { this->value_.store(this->value_.load(std::memory_order::relaxed) + count, std::memory_order::relaxed); }
+
+        /**
+         * @brief Count events from any thread.
+         *
+         * @param count The count of events.
+         */
+        void add_shared(const uint64_t count = 1) { this->value_.fetch_add(count, std::memory_order::relaxed); }
+
+        /**
+         * @brief Get the count.
+         *
+         * @return uint64_t as count.
+         */
+        [[nodiscard]] uint64_t load() const { return this->value_.load(std::memory_order::relaxed); }
+    };
+
+    /**
+     * @brief The count of buckets of a histogram, the last bucket counts all longer durations.
+     */
+    static constexpr size_t STD_HISTOGRAM_BUCKETS = 80;
+
+    /**
+     * @brief The width of a bucket of a histogram.
+     */
+    static constexpr auto STD_HISTOGRAM_WIDTH = std::chrono::microseconds(250);
+
+    /**
+     * @brief Snapshot of a histogram of durations.
+     */
+    struct HistogramStats {
+        /**
+         * @brief The counts per bucket, bucket i counts the durations from i up to i + 1 times the width.
+         */
+        std::array<uint64_t, STD_HISTOGRAM_BUCKETS> buckets{};
+
+        /**
+         * @brief The count of durations.
+         */
+        uint64_t count = 0;
+
+        /**
+         * @brief The shortest duration.
+         */
+        std::chrono::nanoseconds min{};
+
+        /**
+         * @brief The longest duration.
+         */
+        std::chrono::nanoseconds max{};
+
+        /**
+         * @brief The mean duration.
+         */
+        std::chrono::nanoseconds mean{};
+
+        /**
+         * @brief The upper bound of the bucket which contains the given quantile, the longest duration for the last bucket.
+         *
+         * @param quantile The quantile from 0.0 to 1.0.
+         * @return std::chrono::nanoseconds as duration.
+         */
+        [[nodiscard]] std::chrono::nanoseconds percentile(double quantile) const;
+    };
+
+    /**
+     * @brief Lock-free histogram of durations in buckets of equal width, written by one thread and read by any thread.
+     */
+    class Histogram {
+        /**
+         * @brief The counts per bucket.
+         */
+        std::array<Counter, STD_HISTOGRAM_BUCKETS> buckets_;
+
+        /**
+         * @brief The count and the sum of the durations in nanoseconds.
+         */
+        Counter count_, sum_;
+
+        /**
+         * @brief The shortest and the longest duration in nanoseconds.
+         */
+        std::atomic<int64_t> min_, max_;
+
+    public:
+        /**
+         * @brief Constructor of the Histogram class.
+         */
+        Histogram(/* args */);
+
+        /**
+         * @brief Count a duration, only one thread may use this.
+         *
+         * @param duration The duration.
+         */
+        void record(std::chrono::nanoseconds duration);
+
+        /**
+         * @brief Take a snapshot of the histogram.
+         *
+         * @return HistogramStats as snapshot.
+         */
+        [[nodiscard]] HistogramStats snapshot() const;
+    };
+
+    /**
+     * @brief Snapshot of the reassembly statistics of a stream.
+     */
+    struct ParserStats {
+        /**
+         * @brief Rejected headers, by the CRC8 or the length.
+         */
+        uint64_t header_failures = 0;
+
+        /**
+         * @brief Complete messages which are dropped by the CRC16.
+         */
+        uint64_t checksum_failures = 0;
+
+        /**
+         * @brief Bytes which are skipped to find the next header, including the dropped messages.
+         */
+        uint64_t bytes_discarded = 0;
+    };
+
+    /**
+     * @brief Snapshot of the ring between the io thread and the decoder of the receive pipeline.
+     */
+    struct PipelineStats {
+        /**
+         * @brief Messages which wait for the decoder.
+         */
+        uint64_t depth = 0;
+
+        /**
+         * @brief The highest count of waiting messages.
+         */
+        uint64_t max_depth = 0;
+
+        /**
+         * @brief The capacity of the ring.
+         */
+        uint64_t capacity = 0;
+
+        /**
+         * @brief Messages which are dropped because the ring was full.
+         */
+        uint64_t messages_dropped = 0;
+    };
+
+    /**
+     * @brief Snapshot of the statistics of the messages of a device.
+     */
+    struct DeviceStats {
+        /**
+         * @brief The can device id.
+         */
+        uint32_t device_id = 0;
+
+        /**
+         * @brief Received messages.
+         */
+        uint64_t messages = 0;
+
+        /**
+         * @brief Messages whose sequence is not the successor of the previous one.
+         */
+        uint64_t sequence_gaps = 0;
+
+        /**
+         * @brief Messages per second, from the smoothed inter-arrival time.
+         */
+        double rate = 0.0;
+
+        /**
+         * @brief The smoothed inter-arrival time.
+         */
+        std::chrono::nanoseconds interval{};
+
+        /**
+         * @brief The smoothed deviation of consecutive inter-arrival times (RFC 3550).
+         */
+        std::chrono::nanoseconds jitter{};
+
+        /**
+         * @brief The receive time of the first frame of the last message.
+         */
+        std::chrono::system_clock::time_point last;
+    };
+
+    /**
+     * @brief Snapshot of the statistics of the handler.
+     */
+    struct HandlerStats {
+        /**
+         * @brief Received frames.
+         */
+        uint64_t frames_received = 0;
+
+        /**
+         * @brief Received frames of device ids which are not in the registry.
+         */
+        uint64_t frames_unknown = 0;
+
+        /**
+         * @brief Reads which returned without frames after the timeout.
+         */
+        uint64_t read_timeouts = 0;
+
+        /**
+         * @brief Failed reads of the transport.
+         */
+        uint64_t read_failures = 0;
+
+        /**
+         * @brief The reassembly statistics of all devices.
+         */
+        ParserStats parser;
+
+        /**
+         * @brief Valid messages which do not match the type or the payload prefix of their route.
+         */
+        uint64_t messages_unmatched = 0;
+
+        /**
+         * @brief The statistics of the receive pipeline, all zero when it is disabled.
+         */
+        PipelineStats pipeline;
+
+        /**
+         * @brief Sent messages of the sender queue.
+         */
+        uint64_t messages_sent = 0;
+
+        /**
+         * @brief Heartbeats sent from userspace.
+         */
+        uint64_t heartbeats_sent = 0;
+
+        /**
+         * @brief Messages which are dropped from the full sender queue.
+         */
+        uint64_t queue_overflows = 0;
+
+        /**
+         * @brief The periods between the heartbeats sent from userspace.
+         */
+        HistogramStats heartbeat_periods;
+
+        /**
+         * @brief The longest delay of a userspace heartbeat behind its deadline.
+         */
+        std::chrono::nanoseconds heartbeat_lateness{};
+
+        /**
+         * @brief The round-trip times of the acknowledged commands, from the push into the sender queue to the reply.
+         */
+        HistogramStats command_round_trips;
+
+        /**
+         * @brief Commands which were not acknowledged before their deadline.
+         */
+        uint64_t command_timeouts = 0;
+
+        /**
+         * @brief Sends which gave up because the transport was congested.
+         */
+        uint64_t send_busy = 0;
+
+        /**
+         * @brief Failed sends of the transport.
+         */
+        uint64_t send_failures = 0;
+
+        /**
+         * @brief The statistics per device in the order of the registry.
+         */
+        std::array<DeviceStats, Registry::size> devices;
+    };
+
+    /**
+     * @brief Lock-free statistics of the messages of a device, written by the receiving thread and read by any thread.
+     */
+    class DeviceCounters {
+        /**
+         * @brief Received messages.
+         */
+        Counter messages_;
+
+        /**
+         * @brief Messages whose sequence is not the successor of the previous one.
+         */
+        Counter sequence_gaps_;
+
+        /**
+         * @brief The smoothed inter-arrival time in nanoseconds.
+         */
+        std::atomic<int64_t> interval_;
+
+        /**
+         * @brief The smoothed jitter in nanoseconds.
+         */
+        std::atomic<int64_t> jitter_;
+
+        /**
+         * @brief The receive time of the last message in nanoseconds since epoch.
+         */
+        std::atomic<int64_t> last_;
+
+        /**
+         * @brief The previous inter-arrival time, only accessed by the writer.
+         */
+        int64_t previous_interval_;
+
+        /**
+         * @brief The sequence of the last message, only accessed by the writer.
+         */
+        uint16_t sequence_;
+
+    public:
+        /**
+         * @brief Constructor of the DeviceCounters class.
+         */
+        DeviceCounters(/* args */);
+
+        /**
+         * @brief Count a received message.
+         *
+         * @param sequence The sequence of the message.
+         * @param time The receive time of the first frame of the message.
+         */
+        void record(uint16_t sequence, std::chrono::system_clock::time_point time);
+
+        /**
+         * @brief Take a snapshot of the statistics.
+         *
+         * @param device_id The can device id.
+         * @return DeviceStats as snapshot.
+         */
+        [[nodiscard]] DeviceStats snapshot(uint32_t device_id) const;
+    };
+} // namespace robomaster
@@ -0,0 +1,153 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace robomaster {
+    /**
+     * @brief The count of subscriber slots per kind of subscription.
+     */
+    static constexpr size_t STD_MAX_SUBSCRIBERS = 16;
+
+    /**
+     * @brief Fixed slots of subscribers which are dispatched without locks by one publishing thread, while subscribers
+     * are added and removed from any thread. A subscriber may filter by the device id and by the message type, zero matches all.
+     *
+     * @tparam Args The arguments of the callbacks.
+     */
+    template <typename... Args>
+    class Subscribers {
+        /**
+         * @brief The states of a slot.
+         */
+        enum SlotState : uint8_t {
+            SLOT_STATE_FREE = 0x0,
+            SLOT_STATE_CLAIMED = 0x1,
+            SLOT_STATE_ACTIVE = 0x2,
+            SLOT_STATE_REMOVED = 0x3,
+            SLOT_STATE_RELEASED = 0x4,
+        };
+
+        /**
+         * @brief A subscriber on its own cache line.
+         */
+        struct alignas(64) Slot {
+            std::atomic<uint8_t> state{SLOT_STATE_FREE};
+            std::atomic<std::thread::id> caller{};
+            std::atomic<uint32_t> device_id{};
+            std::atomic<uint16_t> type{};
+            std::function<void(Args...)> callback;
+        };
+
+        /**
+         * @brief The subscriber slots.
+         */
+        std::array<Slot, STD_MAX_SUBSCRIBERS> slots_;
+
+        /**
+         * @brief The count of slots which have been in use, the publisher visits only these.
+         */
+        std::atomic<size_t> used_{0};
+
+        /**
+         * @brief Release the callback of a removed slot and free it.
+         */
+        static void release(Slot& slot) {
+            slot.callback = nullptr; slot.state.store(SLOT_STATE_FREE, std::memory_order::release);
+        }
+
+    public:
+        /**
+         * @brief Add a subscriber.
+         *
+         * @param callback The callback which is invoked on the publishing thread.
+         * @param device_id The device id to match, zero for all.
+         * @param type The message type to match, zero for all.
+         * @return size_t as id of the subscription, STD_MAX_SUBSCRIBERS when all slots are in use.
+         */
+        size_t add(std::function<void(Args...)> callback, const uint32_t device_id = 0x0, const uint16_t type = 0x0) {
+            for (size_t i = 0; i < STD_MAX_SUBSCRIBERS; i++) {
+                auto& slot = this->slots_[i]; uint8_t expected = SLOT_STATE_FREE;
+                if (!slot.state.compare_exchange_strong(expected, SLOT_STATE_CLAIMED, std::memory_order::acquire)) { continue; }
+                slot.device_id.store(device_id, std::memory_order::relaxed); slot.type.store(type, std::memory_order::relaxed); slot.callback = std::move(callback); slot.state.store(SLOT_STATE_ACTIVE, std::memory_order::release);
+                for (auto used = this->used_.load(std::memory_order::relaxed); used <= i && !this->used_.compare_exchange_weak(used, i + 1, std::memory_order::release);) { }
+                return i;
+            } return STD_MAX_SUBSCRIBERS;
+        }
+
+        /**
+         * @brief Remove a subscriber, its callback is not running anymore after return. Called from its own callback
+         * the callback is released when it returns.
+         *
+         * @param id The id of the subscription.
+         * @return true, by success, false, when the subscription is unknown.
+         */
+        bool remove(const size_t id) {
+            if (id >= STD_MAX_SUBSCRIBERS) { return false; }
+            auto& slot = this->slots_[id]; const auto self = std::this_thread::get_id(); const auto is_caller = slot.caller.load() == self;
+            uint8_t expected = SLOT_STATE_ACTIVE; if (!slot.state.compare_exchange_strong(expected, is_caller ? SLOT_STATE_RELEASED : SLOT_STATE_REMOVED)) { return false; }
+            if (is_caller) { return true; }
+            for (auto caller = slot.caller.load(); caller != std::thread::id{}; caller = slot.caller.load()) { slot.caller.wait(caller); }
+            release(slot); return true;
+        }
+
+        /**
+         * @brief Invoke the matching subscribers, only one thread may publish. The filter is checked before the handshake with
+         * remove, so a subscriber which does not match costs two relaxed loads, and remove is only notified when it waits.
+         *
+         * @param device_id The device id of the published value.
+         * @param type The message type of the published value.
+         * @param args The arguments of the callbacks.
+         */
+        void publish(const uint32_t device_id, const uint16_t type, Args... args) {
+            const auto used = this->used_.load(std::memory_order::acquire); if (used == 0x0) { return; } const auto self = std::this_thread::get_id();
+            const auto matches = [device_id, type](const Slot& slot) {
+                const auto id = slot.device_id.load(std::memory_order::relaxed); const auto kind = slot.type.load(std::memory_order::relaxed);
+                return (id == 0x0 || id == device_id) && (kind == 0x0 || kind == type);
+            };
+            for (size_t i = 0; i < used; i++) {
+                auto& slot = this->slots_[i]; if (slot.state.load(std::memory_order::acquire) != SLOT_STATE_ACTIVE || !matches(slot)) { continue; }
+                slot.caller.store(self);
+                if (slot.state.load() == SLOT_STATE_ACTIVE && matches(slot)) { slot.callback(args...); }
+                slot.caller.store(std::thread::id{});
+                if (const auto state = slot.state.load(); state == SLOT_STATE_REMOVED) { slot.caller.notify_all(); } else if (state == SLOT_STATE_RELEASED) { release(slot); }
+            }
+        }
+
+        /**
+         * @brief The count of active subscribers, may be outdated.
+         *
+         * @return size_t as count.
+         */
+        [[nodiscard]] size_t size() const {
+            size_t count = 0x0; for (const auto& slot : this->slots_) { if (slot.state.load(std::memory_order::relaxed) == SLOT_STATE_ACTIVE) { count++; } }
+            return count;
+        }
+    };
+} // namespace robomaster
@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+#include <linux/can.h>
+#include <chrono>
+#include <span>
+#include <string>
+
+#include "definitions.h"
+
+namespace robomaster {
+    /**
+     * @brief The maximal count of frames which are transferred with a single syscall.
+     */
+    static constexpr size_t STD_MAX_BATCH_SIZE = 64;
+
+    /**
+     * @brief Interface for the frame io of the handler. Implemented by the SocketCAN bus, the in-process loopback and the replay source.
+     */
+    class Transport {
+    public:
+        /**
+         * @brief Destructor of the Transport class.
+         */
+        virtual ~Transport() = default;
+
+        /**
+         * @brief Open the transport by the given name, for example the can interface or a file.
+         *
+         * @param interface The name of the transport.
+         * @return true, when the transport is open successfully.
+         * @return false, when the transport failed to open.
+         */
+        virtual bool init(const std::string& interface) = 0;
+
+        /**
+         * @brief Set the timeout for reading frames, a timeout of zero reads the available frames without blocking.
+         *
+         * @param seconds Double in seconds.
+         */
+        virtual void set_timeout(double seconds) = 0;
+
+        /**
+         * @brief Receive only standard frames of the given device ids, all frames are received when empty.
+         *
+         * @param device_ids The device ids to receive.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        [[nodiscard]] virtual bool set_filter(std::span<const uint32_t> device_ids) = 0;
+
+        /**
+         * @brief Get a file descriptor which is readable when frames are pending, for multiplexing with epoll.
+         *
+         * @return int as file descriptor, -1 when the transport can not be multiplexed.
+         */
+        [[nodiscard]] virtual int get_descriptor() = 0;
+
+        /**
+         * @brief Get the bitrate of the bus.
+         *
+         * @return uint32_t as bitrate in bit/s, 0 when it is unknown.
+         */
+        [[nodiscard]] virtual uint32_t get_bitrate() { return 0x0; }
+
+        /**
+         * @brief Send multiple can frames in order without waiting for a congested transport.
+         *
+         * @param frames The can frames to send.
+         * @param sent The count of frames from the front which are sent.
+         * @return SEND_STATUS_SENT, when all frames are sent.
+         * @return SEND_STATUS_BUSY, when the transport is congested and not all frames are sent, this is not a failure.
+         * @return SEND_STATUS_FAILED, when failed.
+         */
+        virtual SendStatus send_frames(std::span<const can_frame> frames, size_t& sent) = 0;
+
+        /**
+         * @brief Send multiple can frames in order without waiting for a congested transport.
+         *
+         * @param frames The can frames to send.
+         * @return SendStatus of the transport.
+         */
+        SendStatus send_frames(const std::span<const can_frame> frames) { size_t sent = 0x0; return this->send_frames(frames, sent); }
+
+        /**
+         * @brief Read all pending can frames up to the size of the given frames.
+         * This function is blocking until at least one frame is received or the timeout is reached.
+         * The can id of the received frames contains only the device id without flags.
+         *
+         * @param frames The buffer for the received can frames.
+         * @param timestamps The receive timestamps of the frames, must be at least as large as frames.
+         * @param count The count of received frames, zero when the timeout is reached.
+         * @return true, by success or when the timeout is reached without a frame.
+         * @return false, when failed.
+         */
+        virtual bool read_frames(std::span<can_frame> frames, std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) = 0;
+
+        /**
+         * @brief Let the transport send a cycle of messages periodically on its own, one message per period. The frames are
+         * spread evenly over the period, the first frame is sent at once and frame i of the cycle i * period / message_frames later.
+         *
+         * @param frames The frames of all messages of the cycle in order.
+         * @param message_frames The count of frames of each message.
+         * @param period The period between two messages.
+         * @return true, when the transport sends the cycle.
+         * @return false, when the transport does not support cyclic sending or failed.
+         */
+        virtual bool start_cyclic(std::span<const can_frame> /* frames */, size_t /* message_frames */, std::chrono::microseconds /* period */) { return false; }
+
+        /**
+         * @brief Stop the cyclic sending, does nothing when it is not running.
+         */
+        virtual void stop_cyclic() { }
+    };
+} // namespace robomaster
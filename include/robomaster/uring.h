@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#include <array>
+#include <vector>
+
+#include "can.h"
+
+namespace robomaster {
+    /**
+     * @brief Transport which drives the can socket through io_uring. Receives are kept armed as fixed buffer reads,
+     * the frames of a send are submitted as linked fixed buffer writes with a single syscall.
+     */
+    class UringBus final : public Transport {
+        /**
+         * @brief A mapped io_uring instance, owned by one thread.
+         */
+        struct Ring {
+            int descriptor = -1;
+            void* sq_memory = nullptr; size_t sq_size = 0x0;
+            void* cq_memory = nullptr; size_t cq_size = 0x0;
+            io_uring_sqe* sqes = nullptr; size_t sqes_size = 0x0;
+            uint32_t* sq_head = nullptr; uint32_t* sq_tail = nullptr; uint32_t* sq_array = nullptr; uint32_t sq_mask = 0x0;
+            uint32_t* cq_head = nullptr; uint32_t* cq_tail = nullptr; io_uring_cqe* cqes = nullptr; uint32_t cq_mask = 0x0;
+
+            ~Ring();
+
+            /**
+             * @brief Create the ring and register the buffers for the fixed reads and writes.
+             *
+             * @param entries The count of submission entries.
+             * @param buffers The buffers to register.
+             * @return true, by success.
+             * @return false, when failed.
+             */
+            bool init(uint32_t entries, const iovec& buffers);
+
+            /**
+             * @brief Append a submission entry, it is submitted with the next enter.
+             *
+             * @param sqe The submission entry.
+             */
+            void push(const io_uring_sqe& sqe);
+
+            /**
+             * @brief Take the next completion entry.
+             *
+             * @param cqe The completion entry.
+             * @return true, when a completion was pending.
+             */
+            bool pop(io_uring_cqe& cqe);
+
+            /**
+             * @brief Submit the pushed entries and wait for completions.
+             *
+             * @param submit The count of entries to submit.
+             * @param wait The count of completions to wait for.
+             * @param timeout The timeout of the wait or nullptr.
+             * @return int as submitted entries or the negated errno.
+             */
+            int enter(uint32_t submit, uint32_t wait, const __kernel_timespec* timeout) const;
+        };
+
+        /**
+         * @brief The can bus which opens the socket, applies the profile and the kernel filter.
+         */
+        CANBus bus_;
+
+        /**
+         * @brief The socket which is driven, owned by the can bus or attached.
+         */
+        int socket_;
+
+        /**
+         * @brief The ring for the receive, used by the reading thread.
+         */
+        Ring rx_;
+
+        /**
+         * @brief The ring for the send, used by the sending thread.
+         */
+        Ring tx_;
+
+        /**
+         * @brief Registered buffer of the armed read. Only one read is armed on the socket, concurrent reads of the same socket
+         * may complete out of the order of the frames.
+         */
+        can_frame rx_buffer_;
+
+        /**
+         * @brief Registered buffers of the linked writes.
+         */
+        std::array<can_frame, STD_MAX_BATCH_SIZE> tx_buffers_;
+
+        /**
+         * @brief Count of reads which are re-armed but not yet submitted.
+         */
+        uint32_t rx_pending_;
+
+        /**
+         * @brief The error of a failed read, reported by the next read after the frames received before it.
+         */
+        int rx_error_;
+
+        /**
+         * @brief The device ids to receive for attached sockets without a kernel filter, all frames are received when empty.
+         */
+        std::vector<uint32_t> filter_;
+
+        /**
+         * @brief The read timeout.
+         */
+        __kernel_timespec timeout_;
+
+        /**
+         * @brief Create the rings and arm a read for every receive buffer.
+         *
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        bool init_rings();
+
+        /**
+         * @brief Prepare the fixed read of the receive buffer.
+         */
+        void arm_read();
+
+    public:
+        /**
+         * @brief Constructor of the UringBus class.
+         *
+         * @param profile The socket options which are applied on init.
+         */
+        explicit UringBus(const CANProfile& profile = CANProfile{});
+
+        /**
+         * @brief Destructor of the UringBus class, pending reads are cancelled by closing the rings.
+         */
+        ~UringBus() override = default;
+
+        UringBus(const UringBus&) = delete;
+        UringBus& operator=(const UringBus&) = delete;
+
+        /**
+         * @brief Open the can socket by the given can interface name and create the rings.
+         *
+         * @param interface The name of the can interface.
+         * @return true, when the socket and the rings are created successfully.
+         * @return false, when failed.
+         */
+        bool init(const std::string& interface) override;
+
+        /**
+         * @brief Drive an already open socket which delivers one can frame per read, for example a socket pair. The socket is not closed.
+         *
+         * @param descriptor The socket.
+         * @return true, when the rings are created successfully.
+         * @return false, when failed.
+         */
+        bool attach(int descriptor);
+
+        /**
+         * @brief Set the timeout for reading frames, a timeout of zero reads the available frames without blocking.
+         *
+         * @param seconds Double in seconds.
+         */
+        void set_timeout(double seconds) override;
+
+        /**
+         * @brief Install the kernel filter of the can socket, attached sockets are filtered on read.
+         *
+         * @param device_ids The device ids to receive.
+         * @return true, by success.
+         * @return false, when failed.
+         */
+        [[nodiscard]] bool set_filter(std::span<const uint32_t> device_ids) override;
+
+        /**
+         * @brief Get the receive ring, it is readable when completed reads are pending.
+         *
+         * @return int as file descriptor.
+         */
+        [[nodiscard]] int get_descriptor() override;
+
+        /**
+         * @brief Request the bitrate of the can interface.
+         *
+         * @return uint32_t as bitrate in bit/s, 0 when it is unknown.
+         */
+        [[nodiscard]] uint32_t get_bitrate() override;
+
+        using Transport::send_frames;
+
+        /**
+         * @brief Send the can frames as linked writes with a single submission and wait for their completion.
+         *
+         * @param frames The can frames to send in order.
+         * @param sent The count of frames from the front which are sent.
+         * @return SEND_STATUS_SENT, when all frames are sent.
+         * @return SEND_STATUS_BUSY, when the transmit queue of the interface is full.
+         * @return SEND_STATUS_FAILED, when failed.
+         */
+        SendStatus send_frames(std::span<const can_frame> frames, size_t& sent) override;
+
+        /**
+         * @brief Reap the completed reads and re-arm them with the same syscall which waits for the next completion.
+         * The timestamps are taken on completion since fixed reads carry no control messages.
+         *
+         * @param frames The buffer for the received can frames.
+         * @param timestamps The receive timestamps of the frames, must be at least as large as frames.
+         * @param count The count of received frames, zero when the timeout is reached.
+         * @return true, by success or when the timeout is reached.
+         * @return false, when failed.
+         */
+        bool read_frames(std::span<can_frame> frames, std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) override;
+    };
+} // namespace robomaster
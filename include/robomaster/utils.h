@@ -23,8 +23,17 @@
  */
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "definitions.h"
 
 namespace robomaster {
+    /**
+     * @brief The initial value of the CRC16 of the messages.
+     */
+    static constexpr uint16_t STD_CRC16_SEED = 0x3692;
+
     /**
      * @brief Calculated the CRC8 for the given data.
      *
@@ -43,6 +52,52 @@ namespace robomaster {
      */
     uint16_t get_crc16(const uint8_t* data, size_t length);
 
+    /**
+     * @brief Continue the CRC16 over the next part of the data, the CRC16 of the data is update_crc16(STD_CRC16_SEED, data, length).
+     *
+     * @param crc The CRC16 of the previous parts, STD_CRC16_SEED for the first part.
+     * @param data The next part of the data.
+     * @param length Length of the part.
+     * @return uint16_t CRC16 value including the part.
+     */
+    uint16_t update_crc16(uint16_t crc, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Calculated the CRC8 for the given data with the given kernel, CRC_KERNEL_CLMUL uses the slicing kernel.
+     *
+     * @param data Data for the CRC8 calculation.
+     * @param length Length of the data.
+     * @param kernel The kernel, must be supported.
+     * @return uint8_t CRC8 value.
+     */
+    uint8_t get_crc8(const uint8_t* data, size_t length, CRCKernel kernel);
+
+    /**
+     * @brief Calculated the CRC16 for the given data with the given kernel.
+     *
+     * @param data Data for the CRC16 calculation.
+     * @param length Length of the data.
+     * @param kernel The kernel, must be supported.
+     * @return uint16_t CRC16 value.
+     */
+    uint16_t get_crc16(const uint8_t* data, size_t length, CRCKernel kernel);
+
+    /**
+     * @brief Check if the cpu supports the given kernel, CRC_KERNEL_CLMUL requires PCLMUL (x86) or PMULL (ARMv8).
+     *
+     * @param kernel The kernel.
+     * @return true, when the kernel is supported.
+     * @return false, otherwise.
+     */
+    bool is_supported(CRCKernel kernel);
+
+    /**
+     * @brief Get the kernel which is selected by the cpu features for get_crc8 and get_crc16.
+     *
+     * @return CRCKernel as the fastest supported kernel.
+     */
+    CRCKernel get_crc_kernel();
+
     /**
      * @brief Put the two bytes from little endian in the right host platform order.
      *
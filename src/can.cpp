@@ -22,32 +22,52 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
 #include <cstring>
 #include <cmath>
+#include <fcntl.h>
 #include <unistd.h>
 
 #include <sys/types.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <linux/can/bcm.h>
+#include <linux/can/netlink.h>
+#include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <linux/rtnetlink.h>
+#include <linux/sockios.h>
 
 #include "robomaster/can.h"
 
 namespace robomaster {
-    CANBus::CANBus(): socket_{}, interface_{}, address_{} {
+    static constexpr size_t STD_MAX_CYCLIC_FRAMES = 256;
+    static constexpr size_t STD_MAX_FILTERS = CAN_RAW_FILTER_MAX;
+
+    static_assert(CMSG_SPACE(sizeof(scm_timestamping)) <= sizeof(std::array<uint8_t, 64>), "control buffer too small for the receive timestamps");
+
+    CANBus::CANBus(const CANProfile& profile): socket_{-1}, interface_{}, address_{}, profile_{profile}, rx_headers_{}, rx_vectors_{}, rx_controls_{},
+        cyclic_socket_{-1}, is_cyclic_{false} {
         std::memset(&this->interface_, 0x0, sizeof(this->interface_));
         std::memset(&this->address_, 0x0, sizeof(this->address_));
     }
 
     CANBus::~CANBus() {
-        close(socket_);
+        this->stop_cyclic();
+        if (this->socket_ >= 0x0) { close(this->socket_); }
     }
 
-    void CANBus::set_timeout(const double seconds) const {
+    void CANBus::set_timeout(const double seconds) {
         const auto limit = std::max(seconds, 0.0);
         const auto seconds_ = static_cast<long>(std::floor(limit)), microseconds_ = static_cast<long>((limit - std::floor(limit)) * 1e6);
 
         timeval time{}; time.tv_sec = seconds_; time.tv_usec = microseconds_;
         setsockopt(this->socket_, SOL_SOCKET, SO_RCVTIMEO, &time, sizeof(time));
+        const auto flags = fcntl(this->socket_, F_GETFL); if (flags < 0x0) { return; }
+        fcntl(this->socket_, F_SETFL, time.tv_sec == 0x0 && time.tv_usec == 0x0 ? flags | O_NONBLOCK : flags & ~O_NONBLOCK);
     }
 
     bool CANBus::init(const std::string& interface) {
@@ -60,9 +80,61 @@ namespace robomaster {
 
         ioctl(this->socket_, SIOGIFINDEX, &this->interface_); this->address_.can_ifindex = this->interface_.ifr_ifindex; this->address_.can_family = PF_CAN;
         if (bind(this->socket_, reinterpret_cast<sockaddr*>(&this->address_), sizeof(this->address_)) < 0) { std::printf("[Robomaster]: failed to bind can address\n"); close(this->socket_); return false; }
+
+        constexpr int timestamping = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+        if (setsockopt(this->socket_, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping)) < 0x0) { std::printf("[Robomaster]: failed to enable can timestamps\n"); close(this->socket_); return false; }
+        if (!this->set_profile(this->profile_)) { close(this->socket_); return false; }
+        return true;
+    }
+
+    bool CANBus::set_filter(const std::span<const uint32_t> device_ids) {
+        if (device_ids.size() > STD_MAX_FILTERS) { std::printf("[Robomaster]: too many can filters\n"); return false; }
+        // an empty list installs the zeroed first filter, a mask of zero matches every frame
+        std::array<can_filter, STD_MAX_FILTERS> filters{}; const auto count = std::max<size_t>(device_ids.size(), 1);
+        for (size_t i = 0; i < device_ids.size(); i++) { filters[i].can_id = device_ids[i] & CAN_SFF_MASK; filters[i].can_mask = CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG; }
+        if (setsockopt(this->socket_, SOL_CAN_RAW, CAN_RAW_FILTER, filters.data(), static_cast<socklen_t>(count * sizeof(can_filter))) < 0x0) { std::printf("[Robomaster]: failed to set can filter\n"); return false; }
+        return true;
+    }
+
+    bool CANBus::set_profile(const CANProfile& profile) const {
+        const int loopback = profile.loopback, receive_own = profile.loopback && profile.receive_own;
+        if (setsockopt(this->socket_, SOL_CAN_RAW, CAN_RAW_LOOPBACK, &loopback, sizeof(loopback)) < 0x0) { std::printf("[Robomaster]: failed to set can loopback\n"); return false; }
+        if (setsockopt(this->socket_, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &receive_own, sizeof(receive_own)) < 0x0) { std::printf("[Robomaster]: failed to set can receive own messages\n"); return false; }
         return true;
     }
 
+    int CANBus::get_descriptor() {
+        return this->socket_;
+    }
+
+    /**
+     * @brief Find the attribute of the given type in a list of netlink attributes.
+     */
+    static const rtattr* find_attribute(const rtattr* attribute, int length, const unsigned short type) {
+        for (; RTA_OK(attribute, length); attribute = RTA_NEXT(attribute, length)) { if (attribute->rta_type == type) { return attribute; } }
+        return nullptr;
+    }
+
+    uint32_t CANBus::get_bitrate() {
+        if (this->socket_ < 0x0) { return 0x0; }
+        const auto descriptor = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE); if (descriptor < 0x0) { return 0x0; }
+        struct { nlmsghdr header; ifinfomsg info; } request{};
+        request.header.nlmsg_len = sizeof(request); request.header.nlmsg_type = RTM_GETLINK; request.header.nlmsg_flags = NLM_F_REQUEST; request.header.nlmsg_seq = 1;
+        request.info.ifi_family = AF_UNSPEC; request.info.ifi_index = this->interface_.ifr_ifindex;
+
+        alignas(nlmsghdr) std::array<uint8_t, 8192> buffer{};
+        const auto received = send(descriptor, &request, sizeof(request), 0x0) < 0x0 ? -1 : recv(descriptor, buffer.data(), buffer.size(), 0x0); close(descriptor);
+        const auto* header = reinterpret_cast<const nlmsghdr*>(buffer.data()); const auto length = static_cast<int>(received);
+        if (received < 0x0 || !NLMSG_OK(header, length) || header->nlmsg_type != RTM_NEWLINK) { return 0x0; }
+
+        const auto* info = static_cast<const ifinfomsg*>(NLMSG_DATA(header));
+        const auto* link = find_attribute(IFLA_RTA(info), static_cast<int>(IFLA_PAYLOAD(header)), IFLA_LINKINFO); if (link == nullptr) { return 0x0; }
+        const auto* data = find_attribute(static_cast<const rtattr*>(RTA_DATA(link)), static_cast<int>(RTA_PAYLOAD(link)), IFLA_INFO_DATA); if (data == nullptr) { return 0x0; }
+        const auto* timing = find_attribute(static_cast<const rtattr*>(RTA_DATA(data)), static_cast<int>(RTA_PAYLOAD(data)), IFLA_CAN_BITTIMING);
+        if (timing == nullptr || RTA_PAYLOAD(timing) < sizeof(can_bittiming)) { return 0x0; }
+        can_bittiming bittiming{}; std::memcpy(&bittiming, RTA_DATA(timing), sizeof(bittiming)); return bittiming.bitrate;
+    }
+
     bool CANBus::send_frame(const uint32_t device_id, const uint8_t data[8], const size_t length) const {
         if (length > 8) { std::printf("[Robomaster]: failed to send can frame\n"); return false; }
         can_frame frame{}; std::memset(&frame, 0x0, sizeof(frame));
@@ -71,6 +143,29 @@ namespace robomaster {
         return true;
     }
 
+    SendStatus CANBus::send_frames(const std::span<const can_frame> frames, size_t& sent) {
+        std::array<mmsghdr, STD_MAX_BATCH_SIZE> headers{}; std::array<iovec, STD_MAX_BATCH_SIZE> vectors{}; sent = 0x0;
+        while (sent < frames.size()) {
+            const auto count = std::min(frames.size() - sent, STD_MAX_BATCH_SIZE);
+            for (size_t i = 0; i < count; i++) {
+                vectors[i].iov_base = const_cast<can_frame*>(&frames[sent + i]); vectors[i].iov_len = sizeof(can_frame);
+                headers[i] = mmsghdr{}; headers[i].msg_hdr.msg_iov = &vectors[i]; headers[i].msg_hdr.msg_iovlen = 1;
+            }
+            const auto result = sendmmsg(this->socket_, headers.data(), count, MSG_DONTWAIT);
+            if (result < 0x0 && errno == EINTR) { continue; }
+            if (result <= 0x0) {
+                if (errno != ENOBUFS && errno != EAGAIN) { std::printf("[Robomaster]: failed to send can frames\n"); return SEND_STATUS_FAILED; }
+                return SEND_STATUS_BUSY;
+            }
+            sent += static_cast<size_t>(result);
+        } return SEND_STATUS_SENT;
+    }
+
+    size_t CANBus::get_pending() const {
+        int pending = 0; if (ioctl(this->socket_, SIOCOUTQ, &pending) < 0x0) { return 0x0; }
+        return static_cast<size_t>(std::max(pending, 0));
+    }
+
     bool CANBus::read_frame(uint32_t& device_id, uint8_t data[8], size_t& length) const {
         can_frame frame{}; std::memset(&frame, 0x0, sizeof(frame));
         if(read(this->socket_, &frame, sizeof(frame)) < 0x0) { std::printf("[Robomaster]: failed to read can frame\n"); return false; }
@@ -78,4 +173,46 @@ namespace robomaster {
         length = frame.can_dlc; std::memcpy(data, frame.data, length);
         return true;
     }
+
+    bool CANBus::read_frames(const std::span<can_frame> frames, const std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) {
+        const auto length = std::min({frames.size(), timestamps.size(), STD_MAX_BATCH_SIZE}); count = 0x0;
+        for (size_t i = 0; i < length; i++) {
+            this->rx_vectors_[i].iov_base = &frames[i]; this->rx_vectors_[i].iov_len = sizeof(can_frame);
+            this->rx_headers_[i] = mmsghdr{}; this->rx_headers_[i].msg_hdr.msg_iov = &this->rx_vectors_[i]; this->rx_headers_[i].msg_hdr.msg_iovlen = 1;
+            this->rx_headers_[i].msg_hdr.msg_control = this->rx_controls_[i].data(); this->rx_headers_[i].msg_hdr.msg_controllen = this->rx_controls_[i].size();
+        }
+        const auto received = recvmmsg(this->socket_, this->rx_headers_.data(), length, MSG_WAITFORONE, nullptr);
+        if (received < 0x0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) { return true; }
+        if (received < 0x0) { std::printf("[Robomaster]: failed to read can frames\n"); return false; }
+        const auto now = std::chrono::system_clock::now();
+        for (size_t i = 0; i < static_cast<size_t>(received); i++) {
+            auto& frame = frames[i]; frame.can_id = frame.can_id & CAN_EFF_FLAG ? frame.can_id & CAN_EFF_MASK: frame.can_id & CAN_SFF_MASK; timestamps[i] = now;
+            for (auto* cmsg = CMSG_FIRSTHDR(&this->rx_headers_[i].msg_hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&this->rx_headers_[i].msg_hdr, cmsg)) {
+                if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_TIMESTAMPING) { continue; }
+                scm_timestamping stamp{}; std::memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+                timestamps[i] = std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds{stamp.ts[0].tv_sec} + std::chrono::nanoseconds{stamp.ts[0].tv_nsec})};
+            }
+        } count = static_cast<size_t>(received); return true;
+    }
+
+    bool CANBus::start_cyclic(const std::span<const can_frame> frames, const size_t message_frames, const std::chrono::microseconds period) {
+        if (message_frames == 0x0 || frames.empty() || frames.size() % message_frames != 0x0 || frames.size() > STD_MAX_CYCLIC_FRAMES || period.count() < static_cast<long>(message_frames)) {
+            std::printf("[Robomaster]: invalid cyclic messages\n"); return false;
+        }
+        this->stop_cyclic(); const auto interval = period / static_cast<long>(message_frames);
+        const auto descriptor = socket(PF_CAN, SOCK_DGRAM, CAN_BCM); if (descriptor < 0x0) { std::printf("[Robomaster]: failed to open can broadcast manager\n"); return false; }
+        if (connect(descriptor, reinterpret_cast<sockaddr*>(&this->address_), sizeof(this->address_)) < 0x0) { std::printf("[Robomaster]: failed to connect can broadcast manager\n"); close(descriptor); return false; }
+
+        std::array<uint8_t, sizeof(bcm_msg_head) + STD_MAX_CYCLIC_FRAMES * sizeof(can_frame)> buffer{};
+        bcm_msg_head head{}; head.opcode = TX_SETUP; head.flags = SETTIMER | STARTTIMER | TX_ANNOUNCE; head.can_id = frames[0].can_id; head.nframes = static_cast<uint32_t>(frames.size());
+        head.ival2.tv_sec = interval.count() / 1000000; head.ival2.tv_usec = interval.count() % 1000000;
+        std::memcpy(buffer.data(), &head, sizeof(head)); std::memcpy(buffer.data() + sizeof(head), frames.data(), frames.size() * sizeof(can_frame));
+        if (write(descriptor, buffer.data(), sizeof(head) + frames.size() * sizeof(can_frame)) < 0x0) { std::printf("[Robomaster]: failed to setup cyclic can frames\n"); close(descriptor); return false; }
+        this->cyclic_socket_ = descriptor; this->is_cyclic_.store(true, std::memory_order::release); return true;
+    }
+
+    void CANBus::stop_cyclic() {
+        if (!this->is_cyclic_.exchange(false, std::memory_order::acq_rel)) { return; }
+        close(this->cyclic_socket_); this->cyclic_socket_ = -1;
+    }
 } // namespace robomaster
\ No newline at end of file
@@ -35,7 +35,7 @@ namespace robomaster {
     StateDetector decode_detector(const size_t index, const Message& message) {
         StateDetector data; if (index + 4 > message.get_payload().size()) { return data; }
         data.intensity = message.get_uint16(index);
-        data.hit_time = std::chrono::high_resolution_clock::now();
+        data.hit_time = message.get_first_timestamp();
         return data;
     }
 
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "robomaster/fleet.h"
+
+namespace robomaster {
+    RoboMasterFleet::RoboMasterFleet() = default;
+
+    bool RoboMasterFleet::init(const size_t threads) {
+        if (!this->reactors_.empty()) { std::printf("[Robomaster]: fleet already running\n"); return false; }
+        for (size_t i = 0; i < std::max(threads, static_cast<size_t>(1)); i++) {
+            auto reactor = std::make_shared<Reactor>(); if (!reactor->init()) { this->reactors_.clear(); return false; }
+            this->reactors_.push_back(std::move(reactor));
+        } return true;
+    }
+
+    bool RoboMasterFleet::add(const std::string& interface, const HandlerConfig& config) {
+        return this->add(std::make_unique<RoboMaster>(), interface, config);
+    }
+
+    bool RoboMasterFleet::add(std::unique_ptr<Transport> transport, const std::string& interface, const HandlerConfig& config) {
+        return this->add(std::make_unique<RoboMaster>(std::move(transport)), interface, config);
+    }
+
+    bool RoboMasterFleet::add(std::unique_ptr<RoboMaster> robomaster, const std::string& interface, const HandlerConfig& config) {
+        if (this->reactors_.empty()) { std::printf("[Robomaster]: fleet is not initialized\n"); return false; }
+        auto handler_config = config; handler_config.mode = HANDLER_MODE_REACTOR; handler_config.reactor = this->reactors_[this->robomasters_.size() % this->reactors_.size()];
+        if (!robomaster->init(interface, handler_config)) { return false; }
+        this->robomasters_.push_back(std::move(robomaster)); return true;
+    }
+
+    size_t RoboMasterFleet::size() const {
+        return this->robomasters_.size();
+    }
+
+    RoboMaster& RoboMasterFleet::operator[](const size_t index) {
+        return *this->robomasters_.at(index);
+    }
+
+    bool RoboMasterFleet::is_running() const {
+        return std::ranges::all_of(this->robomasters_, [](const auto& robomaster) { return robomaster->is_running(); });
+    }
+} // namespace robomaster
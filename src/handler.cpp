@@ -22,118 +22,376 @@
  * SOFTWARE.
  */
 
-#include <map>
+#include <algorithm>
+#include <bit>
+#include <ctime>
+#include <unistd.h>
+
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 #include "robomaster/handler.h"
-#include "robomaster/utils.h"
+#include "robomaster/can.h"
 #include "robomaster/payload.h"
+#include "robomaster/registry.h"
 
 namespace robomaster {
     static constexpr size_t STD_MAX_ERROR_COUNT = 5;
+    static constexpr size_t STD_MAX_MESSAGE_FRAMES = 32;
+    static constexpr size_t STD_HEARTBEAT_CYCLE = 64;
     static constexpr auto STD_HEARTBEAT_TIME = std::chrono::milliseconds(10);
+    static constexpr auto STD_HEARTBEAT_GUARD = std::chrono::milliseconds(1);
+    static constexpr auto STD_CYCLIC_MARGIN = std::chrono::microseconds(200);
+    static constexpr auto STD_MAX_BUSY_TIME = std::chrono::seconds(1);
+    static constexpr auto STD_BUSY_RETRY = std::chrono::microseconds(500);
+    static constexpr auto STD_PACER_DEPTH = std::chrono::milliseconds(2);
+    static constexpr uint8_t STD_ATTRIBUTE_REPLY = 0x80;
     static constexpr auto STD_MEMORY_ORDER = std::memory_order::relaxed;
 
-    Handler::Handler(): is_initialised_{false}, is_stopped_{false} { }
+    /**
+     * @brief Convert a time point of the steady clock, which is CLOCK_MONOTONIC, into a timespec for the absolute timers.
+     */
+    static timespec monotonic_time(const std::chrono::steady_clock::time_point time) {
+        const auto value = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        return timespec{value / 1000000000, value % 1000000000};
+    }
+
+    Handler::Handler(): Handler(std::make_unique<CANBus>()) { }
+
+    Handler::Handler(std::unique_ptr<Transport> transport): transport_{std::move(transport)}, timer_descriptor_{-1}, event_descriptor_{-1}, pacer_descriptor_{-1}, commands_pending_{}, messages_sender_{}, pending_count_{}, partial_{}, is_partial_heartbeat_{false}, retry_time_{}, is_held_{false}, heartbeat_counter_{}, heartbeat_frames_{heartbeat_cycle()}, is_cyclic_{false}, is_cyclic_synced_{false}, cyclic_span_{}, hold_time_{},
+        frames_receiver_{}, timestamps_receiver_{}, error_counter_sender_{}, error_counter_receiver_{}, heartbeat_lateness_{}, is_initialised_{false}, is_stopped_{false}, is_started_{false} {
+        this->frames_sender_.reserve(STD_MAX_BATCH_MESSAGES * STD_MAX_MESSAGE_FRAMES);
+    }
 
     Handler::~Handler() {
         if (!this->is_initialised_) { return; }
         this->is_stopped_.store(true, STD_MEMORY_ORDER);
         this->condition_sender_.notify_all();
+        this->stop_reactor();
         this->join_all();
+        this->transport_->stop_cyclic();
+        this->expire_commands(std::chrono::steady_clock::time_point::max(), COMMAND_STATUS_STOPPED);
     }
 
-    bool Handler::init(const std::string& interface) {
+    bool Handler::init(const std::string& interface, const HandlerConfig& config) {
         if (this->is_initialised_) { std::printf("[Robomaster]: already running\n"); return false; }
-        if (!this->can_bus_.init(interface)) { std::printf("[Robomaster]: initialization failure\n"); return false; }
+        if (config.lock_memory && !lock_memory()) { std::printf("[Robomaster]: initialization failure\n"); return false; }
+        if (!this->transport_->init(interface)) { std::printf("[Robomaster]: initialization failure\n"); return false; }
+        if (!this->transport_->set_filter(Registry::device_ids)) { std::printf("[Robomaster]: initialization failure\n"); return false; }
 
-        this->can_bus_.set_timeout(0.1);
-        this->is_initialised_ = true;
+        this->config_ = config; this->queue_sender_.set_capacity(this->config_.queue_capacity);
+        if (this->config_.pipeline) {
+            this->pipeline_ = std::make_unique<Pipeline>();
+            if (!this->pipeline_->init([this](const RawMessage& raw) { this->decode_message(raw); }, this->config_.decoder)) { std::printf("[Robomaster]: initialization failure\n"); this->pipeline_.reset(); return false; }
+        }
+        const auto bitrate = this->config_.bitrate != 0x0 ? this->config_.bitrate : this->transport_->get_bitrate();
+        this->pacer_ = Pacer(bitrate != 0x0 ? bitrate : STD_DEFAULT_BITRATE, this->config_.command_share, STD_PACER_DEPTH);
+        this->transport_->set_timeout(this->config_.mode == HANDLER_MODE_REACTOR ? 0.0 : 0.1); this->heartbeat_deadline_ = std::chrono::steady_clock::now();
+        if (this->config_.kernel_heartbeat) {
+            const auto length = this->heartbeat_frames_.size() / STD_HEARTBEAT_CYCLE; this->cyclic_origin_.store(std::chrono::steady_clock::now(), STD_MEMORY_ORDER);
+            this->cyclic_span_ = (length - 1) * std::chrono::nanoseconds(STD_HEARTBEAT_TIME) / length + this->pacer_.bus_time(std::span{this->heartbeat_frames_}.subspan(length - 1, 1));
+            this->is_cyclic_ = this->transport_->start_cyclic(this->heartbeat_frames_, length, STD_HEARTBEAT_TIME);
+            if (!this->is_cyclic_) { std::printf("[Robomaster]: kernel heartbeat not supported, using userspace heartbeat\n"); }
+            std::array<uint32_t, Registry::size + 1> device_ids{}; std::ranges::copy(Registry::device_ids, device_ids.begin()); device_ids.back() = Payload::DEVICE_ID_INTELLI_CONTROLLER;
+            if (this->is_cyclic_ && !this->transport_->set_filter(device_ids)) { std::printf("[Robomaster]: kernel heartbeat echo not received, using its start time\n"); }
+        }
+        if (this->config_.mode == HANDLER_MODE_REACTOR) {
+            if (!this->init_reactor()) { std::printf("[Robomaster]: initialization failure\n"); this->stop_reactor(); this->join_all(); this->transport_->stop_cyclic(); return false; }
+            this->is_initialised_ = true; return true;
+        }
         this->thread_receiver_ = std::thread{&Handler::receiver_thread, this};
         this->thread_sender_ = std::thread{&Handler::sender_thread, this};
-        return true;
+        const auto is_receiver = set_thread_config(this->thread_receiver_, this->config_.receiver), is_sender = set_thread_config(this->thread_sender_, this->config_.sender);
+        if (!is_receiver || !is_sender) { this->is_stopped_.store(true, STD_MEMORY_ORDER); }
+        this->is_started_.store(true); this->is_started_.notify_all();
+        if (!is_receiver || !is_sender) {
+            std::printf("[Robomaster]: initialization failure\n"); this->condition_sender_.notify_all(); this->join_all(); this->transport_->stop_cyclic();
+            this->is_started_.store(false); this->is_stopped_.store(false, STD_MEMORY_ORDER); return false;
+        }
+        this->is_initialised_ = true; return true;
+    }
+
+    bool Handler::init_reactor() {
+        const auto descriptor = this->transport_->get_descriptor();
+        if (descriptor < 0x0) { std::printf("[Robomaster]: transport does not support the reactor mode\n"); return false; }
+        this->event_descriptor_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC); this->pacer_descriptor_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (this->event_descriptor_ < 0x0 || this->pacer_descriptor_ < 0x0) { std::printf("[Robomaster]: failed to create reactor descriptors\n"); return false; }
+        this->timer_descriptor_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (this->timer_descriptor_ < 0x0) { std::printf("[Robomaster]: failed to create reactor descriptors\n"); return false; }
+        itimerspec interval{}; interval.it_interval.tv_nsec = std::chrono::nanoseconds(STD_HEARTBEAT_TIME).count(); interval.it_value = monotonic_time(this->heartbeat_deadline_);
+        if (timerfd_settime(this->timer_descriptor_, TFD_TIMER_ABSTIME, &interval, nullptr) < 0x0) { std::printf("[Robomaster]: failed to start heartbeat timer\n"); return false; }
+
+        const auto failure = [this](const size_t error_counter) {
+            if (error_counter <= STD_MAX_ERROR_COUNT) { return; }
+            std::printf("[Robomaster]: reactor frame failure\n"); this->is_stopped_.store(true, STD_MEMORY_ORDER); this->unregister_reactor(); this->transport_->stop_cyclic();
+            this->expire_commands(std::chrono::steady_clock::time_point::max(), COMMAND_STATUS_STOPPED);
+        };
+        this->reactor_ = this->config_.reactor; if (!this->reactor_) { this->reactor_ = std::make_shared<Reactor>(); if (!this->reactor_->init(this->config_.sender)) { return false; } }
+        const auto drain = [this, failure](const int source) {
+            uint64_t events = 0; [[maybe_unused]] const auto result = read(source, &events, sizeof(events));
+            if (this->is_stopped_.load(STD_MEMORY_ORDER)) { return; }
+            const auto now = std::chrono::steady_clock::now(); this->expire_commands(now); this->run_sender(now); failure(this->error_counter_sender_);
+            itimerspec expiration{};
+            if (now < this->retry_time_) { expiration.it_value = monotonic_time(this->retry_time_); }
+            else if (this->has_queued() && !this->is_held_ && (!this->pacer_.is_ready(now) || now < this->hold_time_)) { expiration.it_value = monotonic_time(std::max(this->pacer_.ready_time(), this->hold_time_)); }
+            else { return; }
+            timerfd_settime(this->pacer_descriptor_, TFD_TIMER_ABSTIME, &expiration, nullptr);
+        };
+        return this->reactor_->add(this->timer_descriptor_, [this, drain](uint32_t) { drain(this->timer_descriptor_); })
+            && this->reactor_->add(descriptor, [this, failure](uint32_t) {
+                if (this->receive_frames()) { this->error_counter_receiver_ = 0x0; } else { this->error_counter_receiver_++; } failure(this->error_counter_receiver_);
+            })
+            && this->reactor_->add(this->event_descriptor_, [this, drain](uint32_t) { drain(this->event_descriptor_); })
+            && this->reactor_->add(this->pacer_descriptor_, [this, drain](uint32_t) { drain(this->pacer_descriptor_); });
+    }
+
+    void Handler::unregister_reactor() {
+        if (!this->reactor_) { return; }
+        this->reactor_->remove(this->transport_->get_descriptor());
+        if (this->timer_descriptor_ >= 0x0) { this->reactor_->remove(this->timer_descriptor_); }
+        if (this->event_descriptor_ >= 0x0) { this->reactor_->remove(this->event_descriptor_); }
+        if (this->pacer_descriptor_ >= 0x0) { this->reactor_->remove(this->pacer_descriptor_); }
+    }
+
+    void Handler::stop_reactor() {
+        this->unregister_reactor(); this->reactor_.reset();
+        if (this->timer_descriptor_ >= 0x0) { close(this->timer_descriptor_); this->timer_descriptor_ = -1; }
+        if (this->event_descriptor_ >= 0x0) { close(this->event_descriptor_); this->event_descriptor_ = -1; }
+        if (this->pacer_descriptor_ >= 0x0) { close(this->pacer_descriptor_); this->pacer_descriptor_ = -1; }
     }
 
     void Handler::join_all() {
         if (this->thread_receiver_.joinable()) { this->thread_receiver_.join(); }
         if (this->thread_sender_.joinable()) { this->thread_sender_.join(); }
+        if (this->pipeline_) { this->pipeline_->stop(); }
     }
 
     bool Handler::is_running() const {
         return this->is_initialised_ && !this->is_stopped_.load(STD_MEMORY_ORDER);
     }
 
-    void Handler::push_message(const Message& message) {
-        this->queue_sender_.push(message);
+    void Handler::push_message(const Message& message, const CommandClass command_class) {
+        if (!this->queue_sender_.push(message, command_class)) { this->queue_overflows_.add_shared(); }
+        if (this->event_descriptor_ >= 0x0) { constexpr uint64_t value = 1; [[maybe_unused]] const auto result = write(this->event_descriptor_, &value, sizeof(value)); return; }
         this->condition_sender_.notify_one();
     }
 
+    std::future<CommandResult> Handler::push_command(const Message& message, const CommandClass command_class, const std::chrono::milliseconds timeout) {
+        std::promise<CommandResult> promise; auto future = promise.get_future();
+        if (!this->is_running() || message.get_length() < 13) { promise.set_value(CommandResult{COMMAND_STATUS_STOPPED}); return future; }
+        {
+            std::lock_guard lock{this->commands_mutex_}; const auto now = std::chrono::steady_clock::now();
+            const auto command = std::ranges::find_if(this->commands_, [](const PendingCommand& pending) { return !pending.is_pending; });
+            if (command == this->commands_.end()) { promise.set_value(CommandResult{COMMAND_STATUS_OVERFLOW}); }
+            else {
+                *command = PendingCommand{true, std::byteswap(message.get_type()), message.get_sequence(), message.get_uint8(1), message.get_uint8(2), now, now + timeout, std::move(promise)};
+                this->commands_pending_.fetch_add(1, STD_MEMORY_ORDER);
+            }
+        }
+        this->push_message(message, command_class); return future;
+    }
+
+    bool Handler::acknowledge_command(const Message& message) {
+        if (message.get_length() < 13 || (message.get_uint8(0) & STD_ATTRIBUTE_REPLY) == 0x0) { return false; }
+        std::lock_guard lock{this->commands_mutex_}; const auto now = std::chrono::steady_clock::now();
+        for (auto& command : this->commands_) {
+            if (!command.is_pending || command.type != message.get_type() || command.sequence != message.get_sequence() || command.command_set != message.get_uint8(1) || command.command_id != message.get_uint8(2)) { continue; }
+            const auto round_trip = std::chrono::duration_cast<std::chrono::nanoseconds>(now - command.start); this->command_round_trips_.record(round_trip);
+            command.promise.set_value(CommandResult{COMMAND_STATUS_ACKNOWLEDGED, round_trip, message}); command.is_pending = false; this->commands_pending_.fetch_sub(1, STD_MEMORY_ORDER); return true;
+        } return false;
+    }
+
+    void Handler::expire_commands(const std::chrono::steady_clock::time_point now, const CommandStatus status) {
+        if (this->commands_pending_.load(STD_MEMORY_ORDER) == 0x0) { return; }
+        std::lock_guard lock{this->commands_mutex_};
+        for (auto& command : this->commands_) {
+            if (!command.is_pending || command.deadline > now) { continue; } if (status == COMMAND_STATUS_TIMEOUT) { this->command_timeouts_.add(); }
+            command.promise.set_value(CommandResult{status}); command.is_pending = false; this->commands_pending_.fetch_sub(1, STD_MEMORY_ORDER);
+        }
+    }
+
+    HandlerStats Handler::stats() const {
+        HandlerStats stats; stats.frames_received = this->frames_received_.load(); stats.frames_unknown = this->frames_unknown_.load();
+        stats.read_timeouts = this->read_timeouts_.load(); stats.read_failures = this->read_failures_.load(); stats.messages_unmatched = this->messages_unmatched_.load();
+        if (this->pipeline_) { stats.pipeline = this->pipeline_->stats(); }
+        stats.messages_sent = this->messages_sent_.load(); stats.heartbeats_sent = this->heartbeats_sent_.load(); stats.queue_overflows = this->queue_overflows_.load();
+        stats.heartbeat_periods = this->heartbeat_periods_.snapshot(); stats.heartbeat_lateness = std::chrono::nanoseconds(this->heartbeat_lateness_.load(STD_MEMORY_ORDER));
+        stats.command_round_trips = this->command_round_trips_.snapshot(); stats.command_timeouts = this->command_timeouts_.load();
+        stats.send_busy = this->send_busy_.load(); stats.send_failures = this->send_failures_.load();
+        for (size_t i = 0; i < Registry::size; i++) {
+            const auto parser = this->parsers_[i].stats(); stats.devices[i] = this->device_counters_[i].snapshot(Registry::device_ids[i]);
+            stats.parser.header_failures += parser.header_failures; stats.parser.checksum_failures += parser.checksum_failures; stats.parser.bytes_discarded += parser.bytes_discarded;
+        } return stats;
+    }
+
     void Handler::set_callback(std::function<void(const Message&)> completion) {
         this->state_callback_ = std::move(completion);
     }
 
-    bool Handler::send_message(const Message& message) const {
-        const auto id = message.get_device_id(); const auto data = message.vector(); uint8_t frame_data[8] = {};
-        for (size_t i = 0; i < data.size(); i += 8) {
-            const size_t frame_length = std::min(static_cast<size_t>(8), data.size() - i);
-            std::copy_n(data.begin() + static_cast<long>(i), frame_length, frame_data);
-            if (!this->can_bus_.send_frame(id, frame_data, frame_length)) { return false; }
+    size_t Handler::subscribe(std::function<void(const Message&)> callback, const uint32_t device_id, const uint16_t type) {
+        return this->message_subscribers_.add(std::move(callback), device_id, type);
+    }
+
+    size_t Handler::subscribe_frames(std::function<void(const can_frame&, std::chrono::system_clock::time_point)> callback, const uint32_t device_id) {
+        return this->frame_subscribers_.add(std::move(callback), device_id);
+    }
+
+    bool Handler::unsubscribe(const size_t subscription) {
+        return this->message_subscribers_.remove(subscription);
+    }
+
+    bool Handler::unsubscribe_frames(const size_t subscription) {
+        return this->frame_subscribers_.remove(subscription);
+    }
+
+    void Handler::encode_frames(const Message& message, std::vector<can_frame>& frames) {
+        std::array<uint8_t, STD_MAX_MESSAGE_LENGTH> data; const auto id = message.get_device_id(); const auto length = message.encode(data);
+        for (size_t i = 0; i < length; i += 8) {
+            can_frame frame{}; frame.can_id = id; frame.can_dlc = std::min(static_cast<size_t>(8), length - i);
+            std::copy_n(data.begin() + static_cast<long>(i), frame.can_dlc, frame.data); frames.push_back(frame);
+        }
+    }
+
+    std::vector<can_frame> Handler::heartbeat_cycle() {
+        std::vector<can_frame> frames;
+        for (uint16_t counter = 0; counter < STD_HEARTBEAT_CYCLE; counter++) { encode_frames(Message{Payload::DEVICE_ID_INTELLI_CONTROLLER, Payload::DEVICE_TYPE_CHASSIS, counter, Payload::HEART_BEAT}, frames); }
+        return frames;
+    }
+
+    SendStatus Handler::send_heartbeat() {
+        const auto length = this->heartbeat_frames_.size() / STD_HEARTBEAT_CYCLE, offset = this->heartbeat_counter_++ % STD_HEARTBEAT_CYCLE * length;
+        const auto frames = std::span{this->heartbeat_frames_}.subspan(offset, length); size_t sent = 0x0;
+        const auto status = this->transport_->send_frames(frames, sent); if (status == SEND_STATUS_SENT) { this->complete_heartbeat(); return status; }
+        if (sent != 0x0 && sent < length) { this->partial_ = frames.subspan(sent); this->is_partial_heartbeat_ = true; } return status;
+    }
+
+    void Handler::complete_heartbeat() {
+        const auto now = std::chrono::steady_clock::now(); this->heartbeats_sent_.add(); this->is_held_ = false;
+        if (this->heartbeat_last_ != std::chrono::steady_clock::time_point{}) { this->heartbeat_periods_.record(now - this->heartbeat_last_); } this->heartbeat_last_ = now;
+        const auto lateness = std::chrono::duration_cast<std::chrono::nanoseconds>(now - this->heartbeat_deadline_).count();
+        if (lateness > this->heartbeat_lateness_.load(STD_MEMORY_ORDER)) { this->heartbeat_lateness_.store(lateness, STD_MEMORY_ORDER); } this->advance_heartbeat(now);
+    }
+
+    SendStatus Handler::send_partial() {
+        size_t sent = 0x0; const auto status = this->transport_->send_frames(this->partial_, sent); this->partial_ = this->partial_.subspan(std::min(sent, this->partial_.size()));
+        if (status != SEND_STATUS_SENT) { return status; }
+        if (this->is_partial_heartbeat_) { this->complete_heartbeat(); } else { this->messages_sent_.add(); } return status;
+    }
+
+    void Handler::run_sender(const std::chrono::steady_clock::time_point now) {
+        if (now < this->retry_time_) { return; }
+        const auto is_retry = [this, now](const SendStatus status) { if (this->account_send(status)) { return false; } this->retry_time_ = now + STD_BUSY_RETRY; return true; };
+        if (!this->partial_.empty() && is_retry(this->send_partial())) { return; }
+        if (!this->is_cyclic_ && this->heartbeat_deadline_ <= now && is_retry(this->send_heartbeat())) { return; }
+        while (this->has_queued() && !this->is_held_ && this->pacer_.is_ready(now) && now >= this->hold_time_) { if (is_retry(this->send_queued())) { return; } }
+    }
+
+    void Handler::advance_heartbeat(const std::chrono::steady_clock::time_point now) {
+        do { this->heartbeat_deadline_ += STD_HEARTBEAT_TIME; } while (this->heartbeat_deadline_ <= now);
+    }
+
+    std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point> Handler::cyclic_window(const std::chrono::steady_clock::time_point time) const {
+        const auto origin = this->cyclic_origin_.load(STD_MEMORY_ORDER); const auto elapsed = std::max(time - origin, std::chrono::steady_clock::duration::zero());
+        const auto periods = elapsed / STD_HEARTBEAT_TIME; const auto is_synced = this->is_cyclic_synced_.load(STD_MEMORY_ORDER);
+        const auto start = origin + (is_synced && periods < 2 ? 0 : std::max<decltype(periods)>(periods, is_synced ? 0 : 2)) * STD_HEARTBEAT_TIME;
+        return { start + this->cyclic_span_ + STD_CYCLIC_MARGIN, start + STD_HEARTBEAT_TIME - STD_CYCLIC_MARGIN };
+    }
+
+    void Handler::sync_cyclic(const can_frame& frame, const std::chrono::system_clock::time_point timestamp) {
+        const auto length = this->heartbeat_frames_.size() / STD_HEARTBEAT_CYCLE; if (!this->is_cyclic_ || frame.can_dlc != this->heartbeat_frames_[length - 1].can_dlc) { return; }
+        for (size_t i = length - 1; i < this->heartbeat_frames_.size(); i += length) {
+            if (!std::equal(frame.data, frame.data + frame.can_dlc, this->heartbeat_frames_[i].data)) { continue; }
+            const auto end = std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::system_clock::now() - timestamp);
+            this->cyclic_origin_.store(end - this->cyclic_span_, STD_MEMORY_ORDER); this->is_cyclic_synced_.store(true, STD_MEMORY_ORDER); return;
+        }
+    }
+
+    bool Handler::has_queued() const {
+        return !this->partial_.empty() || this->pending_count_ != 0x0 || !this->queue_sender_.empty();
+    }
+
+    SendStatus Handler::send_queued() {
+        this->frames_sender_.clear(); std::array<size_t, STD_MAX_BATCH_MESSAGES> ends{}; size_t count = 0x0; const auto now = std::chrono::steady_clock::now(); auto end = now;
+        for (; count < STD_MAX_BATCH_MESSAGES && this->pacer_.is_ready(now); count++) {
+            while (count < this->pending_count_ && this->queue_sender_.is_superseded(this->messages_sender_[count].command_class)) {
+                std::move(this->messages_sender_.begin() + static_cast<long>(count) + 1, this->messages_sender_.begin() + static_cast<long>(this->pending_count_), this->messages_sender_.begin() + static_cast<long>(count)); this->pending_count_--;
+            }
+            auto& outgoing = this->messages_sender_[count];
+            if (count == this->pending_count_) { if (!this->queue_sender_.pop(outgoing.message, outgoing.command_class)) { break; } this->pending_count_++; }
+            const auto offset = this->frames_sender_.size(); encode_frames(outgoing.message, this->frames_sender_);
+            const auto frames = std::span{this->frames_sender_}.subspan(offset); const auto time = this->pacer_.bus_time(frames);
+            const auto is_oversized = count == 0x0 && time > STD_HEARTBEAT_TIME - STD_HEARTBEAT_GUARD;
+            if (this->is_cyclic_) {
+                const auto [open, close] = this->cyclic_window(end);
+                if (end < open || (!is_oversized && end + time > close)) { this->frames_sender_.resize(offset); this->hold_time_ = end < open ? open : std::max(open + STD_HEARTBEAT_TIME, now + STD_CYCLIC_MARGIN); break; }
+            } else if (!is_oversized && end + time > this->heartbeat_deadline_ - STD_HEARTBEAT_GUARD) { this->frames_sender_.resize(offset); this->is_held_ = true; break; }
+            end += time; this->pacer_.consume(frames, now); ends[count] = this->frames_sender_.size();
+        }
+        if (count == 0x0) { return SEND_STATUS_SENT; }
+
+        size_t sent = 0x0; const auto status = this->transport_->send_frames(this->frames_sender_, sent);
+        auto done = static_cast<size_t>(std::ranges::count_if(std::span{ends}.first(count), [sent](const size_t frames) { return frames <= sent; })); this->messages_sent_.add(done);
+        if (done < count && sent > (done == 0x0 ? 0x0 : ends[done - 1])) { this->partial_ = std::span{this->frames_sender_}.subspan(sent, ends[done] - sent); this->is_partial_heartbeat_ = false; done++; }
+        std::move(this->messages_sender_.begin() + static_cast<long>(done), this->messages_sender_.begin() + static_cast<long>(this->pending_count_), this->messages_sender_.begin());
+        this->pending_count_ -= done; return status;
+    }
+
+    bool Handler::account_send(const SendStatus status) {
+        if (status == SEND_STATUS_SENT) { this->error_counter_sender_ = 0x0; this->busy_since_.reset(); return true; }
+        if (status == SEND_STATUS_BUSY) {
+            this->send_busy_.add(); const auto now = std::chrono::steady_clock::now(); if (!this->busy_since_) { this->busy_since_ = now; }
+            if (now - *this->busy_since_ <= STD_MAX_BUSY_TIME) { return false; }
+        } else { this->send_failures_.add(); } this->error_counter_sender_++; return false;
+    }
+
+    bool Handler::receive_frames() {
+        size_t frame_count = 0x0; if (!this->transport_->read_frames(this->frames_receiver_, this->timestamps_receiver_, frame_count)) { this->read_failures_.add(); return false; }
+        if (frame_count == 0x0) { this->read_timeouts_.add(); return true; } this->frames_received_.add(frame_count);
+        for (size_t i = 0; i < frame_count; i++) {
+            const auto& frame = this->frames_receiver_[i]; this->frame_subscribers_.publish(frame.can_id, 0x0, frame, this->timestamps_receiver_[i]);
+            if (frame.can_id == Payload::DEVICE_ID_INTELLI_CONTROLLER) { this->sync_cyclic(frame, this->timestamps_receiver_[i]); continue; }
+            const auto index = Registry::index(frame.can_id); if (index == Registry::size) { this->frames_unknown_.add(); continue; }
+            this->parsers_[index].push(std::span{frame.data, frame.can_dlc}, this->timestamps_receiver_[i], [this, &frame, index](const std::span<const uint8_t> data, const auto first, const auto last) {
+                if (this->pipeline_) { this->pipeline_->push(index, frame.can_id, data, first, last); return; }
+                auto msg = Message{frame.can_id, data}; msg.set_timestamps(first, last); if (msg.is_valid()) { this->receive_message(index, msg); }
+            });
         } return true;
     }
 
-    void Handler::receive_message(const Message& message) const {
-        const auto& payload = message.get_payload(); const auto msg_type = message.get_type(); const auto device_id = message.get_device_id();
-        static const std::unordered_map<uint16_t, std::pair<uint16_t, std::vector<uint8_t>>> device_ids = {
-            { Payload::DEVICE_ID_MOTION_CONTROLLER, { Payload::DEVICE_RC_TYPE_MOTION_CONTROLLER, Payload::MESSAGE_MOTION_CONTROLLER } },
-            { Payload::DEVICE_ID_GIMBAL, { Payload::DEVICE_RC_TYPE_GIMBAL, Payload::MESSAGE_GIMBAL } },
-            { Payload::DEVICE_ID_HIT_DETECTOR_1, { Payload::DEVICE_RC_TYPE_HIT_DETECTOR_1, Payload::MESSAGE_HIT_DETECTOR_1 } },
-            { Payload::DEVICE_ID_HIT_DETECTOR_2, { Payload::DEVICE_RC_TYPE_HIT_DETECTOR_2, Payload::MESSAGE_HIT_DETECTOR_2 } },
-            { Payload::DEVICE_ID_HIT_DETECTOR_3, { Payload::DEVICE_RC_TYPE_HIT_DETECTOR_3, Payload::MESSAGE_HIT_DETECTOR_3 } },
-            { Payload::DEVICE_ID_HIT_DETECTOR_4, { Payload::DEVICE_RC_TYPE_HIT_DETECTOR_4, Payload::MESSAGE_HIT_DETECTOR_4 } },
-        };
-        const auto ids = device_ids.find(device_id); if (ids == device_ids.end() || msg_type != ids->second.first) { return; }
-        const auto& sequence = ids->second.second; if (payload.size() < sequence.size() || !std::equal(sequence.begin(), sequence.end(), payload.begin())) { return; }
+    void Handler::decode_message(const RawMessage& raw) {
+        auto msg = Message{raw.device_id, std::span{raw.data.data(), raw.length}}; msg.set_timestamps(raw.first, raw.last);
+        if (msg.is_valid()) { this->receive_message(raw.index, msg); }
+    }
+
+    void Handler::receive_message(const size_t index, const Message& message) {
+        this->message_subscribers_.publish(message.get_device_id(), message.get_type(), message);
+        if (this->commands_pending_.load(STD_MEMORY_ORDER) != 0x0 && this->acknowledge_command(message)) { return; }
+        if (!Registry::match(index, message)) { this->messages_unmatched_.add(); return; }
+        this->device_counters_[index].record(message.get_sequence(), message.get_first_timestamp());
         if (this->state_callback_) { this->state_callback_(message); }
     }
 
     void Handler::sender_thread() {
-        uint16_t heartbeat_counter = 0x0; size_t error_counter = 0x0; auto heartbeat_time_point = std::chrono::high_resolution_clock::now();
-        while (error_counter <= STD_MAX_ERROR_COUNT && !this->is_stopped_.load(STD_MEMORY_ORDER)) {
-            if (heartbeat_time_point < std::chrono::high_resolution_clock::now()) {
-                const auto msg = Message{Payload::DEVICE_ID_INTELLI_CONTROLLER, Payload::DEVICE_TYPE_CHASSIS, heartbeat_counter++, Payload::HEART_BEAT};
-                if (this->send_message(msg)) { heartbeat_time_point += STD_HEARTBEAT_TIME; error_counter = 0x0; } else { error_counter++; }
-            } else if (!this->queue_sender_.empty()) {
-                if (Message msg = queue_sender_.pop(); msg.is_valid()) { if (this->send_message(msg)) { error_counter = 0x0; } else { error_counter++; } }
-            } else { std::unique_lock lock{this->condition_sender_mutex_}; this->condition_sender_.wait_until(lock, heartbeat_time_point); }
+        this->is_started_.wait(false);
+        while (this->error_counter_sender_ <= STD_MAX_ERROR_COUNT && !this->is_stopped_.load(STD_MEMORY_ORDER)) {
+            const auto now = std::chrono::steady_clock::now(); this->expire_commands(now);
+            if (!this->is_cyclic_ && this->partial_.empty() && now >= this->retry_time_ && now < this->heartbeat_deadline_ && this->heartbeat_deadline_ - now <= STD_HEARTBEAT_GUARD) {
+                const auto deadline = monotonic_time(this->heartbeat_deadline_); clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr); continue;
+            }
+            this->run_sender(now);
+            const auto heartbeat = this->is_cyclic_ ? now + STD_HEARTBEAT_TIME : this->heartbeat_deadline_ - STD_HEARTBEAT_GUARD;
+            const auto wake = now < this->retry_time_ ? this->retry_time_ : !this->has_queued() || this->is_held_ ? heartbeat : std::min(heartbeat, std::max(this->pacer_.ready_time(), this->hold_time_));
+            std::unique_lock lock{this->condition_sender_mutex_}; this->condition_sender_.wait_until(lock, wake);
         }
-        if (error_counter != 0x0) { this->is_stopped_.store(true, STD_MEMORY_ORDER); std::printf("[Robomaster]: sender frame failure\n"); }
+        this->transport_->stop_cyclic(); this->expire_commands(std::chrono::steady_clock::time_point::max(), COMMAND_STATUS_STOPPED);
+        if (this->error_counter_sender_ != 0x0) { this->is_stopped_.store(true, STD_MEMORY_ORDER); std::printf("[Robomaster]: sender frame failure\n"); }
     }
 
     void Handler::receiver_thread() {
-        struct CANMessage { std::vector<uint8_t> buffer; size_t length = 0x0; };
-        uint32_t frame_id; uint8_t frame_buffer[8] = {}; size_t frame_length; size_t error_counter = 0x0;
-        std::map<uint32_t, CANMessage> can_message {
-            { Payload::DEVICE_ID_MOTION_CONTROLLER, CANMessage{} }, { Payload::DEVICE_ID_GIMBAL, CANMessage{} },
-            { Payload::DEVICE_ID_HIT_DETECTOR_1, CANMessage{} }, { Payload::DEVICE_ID_HIT_DETECTOR_2, CANMessage{} },
-            { Payload::DEVICE_ID_HIT_DETECTOR_3, CANMessage{} }, { Payload::DEVICE_ID_HIT_DETECTOR_4, CANMessage{} },
-        };
-        while (error_counter <= STD_MAX_ERROR_COUNT && !this->is_stopped_.load(STD_MEMORY_ORDER)) {
-            if (!can_bus_.read_frame(frame_id, frame_buffer, frame_length)) { error_counter++; continue; }
-            auto slice = can_message.find(frame_id); if (slice == can_message.end()) { continue; }
-            auto&[buffer, length] = slice->second; buffer.insert(std::end(buffer), frame_buffer, frame_buffer + frame_length);
-
-            if (length == 0) {
-                auto iterator = buffer.cbegin();
-                while (iterator != buffer.cend()) {
-                    iterator = std::find(iterator, std::cend(buffer), 0x55); buffer.erase(std::cbegin(buffer), iterator);
-                    if(buffer.size() < 4) { break; } if(buffer[3] == get_crc8(buffer.data(), 3)) { length = buffer[1]; break; } ++iterator;
-                }
-            } else if (length <= buffer.size()) {
-                if (get_crc16(buffer.data(), length - 2) == get_little_endian(buffer[length - 2], buffer[length - 1])) {
-                    auto const msg = Message{frame_id, std::vector(std::cbegin(buffer), std::cbegin(buffer) + static_cast<long>(length))};
-                    if (msg.is_valid()) { this->receive_message(msg); }
-                } buffer.erase(std::cbegin(buffer), std::cbegin(buffer) + static_cast<long>(length)); length = 0x0;
-            }
+        this->is_started_.wait(false);
+        while (this->error_counter_receiver_ <= STD_MAX_ERROR_COUNT && !this->is_stopped_.load(STD_MEMORY_ORDER)) {
+            if (this->receive_frames()) { this->error_counter_receiver_ = 0x0; } else { this->error_counter_receiver_++; }
         }
-        if (error_counter != 0x0) { this->is_stopped_.store(true, STD_MEMORY_ORDER); std::printf("[Robomaster]: receiver frame failure\n"); }
+        if (this->error_counter_receiver_ != 0x0) { this->is_stopped_.store(true, STD_MEMORY_ORDER); std::printf("[Robomaster]: receiver frame failure\n"); }
     }
-} // namespace robomaster
\ No newline at end of file
+} // namespace robomaster
@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <unistd.h>
+
+#include <sys/eventfd.h>
+
+#include "robomaster/loopback.h"
+
+namespace robomaster {
+    static constexpr size_t STD_SPIN_COUNT = 64;
+    static constexpr auto STD_POLL_INTERVAL = std::chrono::microseconds(50);
+
+    LoopbackBus::Channel::~Channel() {
+        for (const auto& event : this->events) { if (const auto descriptor = event.load(); descriptor >= 0x0) { close(descriptor); } }
+    }
+
+    LoopbackBus::LoopbackBus(std::shared_ptr<Channel> channel, const size_t side): channel_{std::move(channel)}, side_{side}, timeout_{0} { }
+
+    std::pair<std::unique_ptr<LoopbackBus>, std::unique_ptr<LoopbackBus>> LoopbackBus::create_pair() {
+        const auto channel = std::make_shared<Channel>();
+        return { std::unique_ptr<LoopbackBus>(new LoopbackBus(channel, 0)), std::unique_ptr<LoopbackBus>(new LoopbackBus(channel, 1)) };
+    }
+
+    bool LoopbackBus::init(const std::string&) {
+        return true;
+    }
+
+    void LoopbackBus::set_timeout(const double seconds) {
+        this->timeout_ = std::chrono::microseconds(static_cast<long>(std::max(seconds, 0.0) * 1e6));
+    }
+
+    bool LoopbackBus::set_filter(const std::span<const uint32_t> device_ids) {
+        this->filter_.assign(device_ids.begin(), device_ids.end());
+        return true;
+    }
+
+    int LoopbackBus::get_descriptor() {
+        auto& event = this->channel_->events[this->side_]; if (const auto descriptor = event.load(); descriptor >= 0x0) { return descriptor; }
+        const auto descriptor = eventfd(this->channel_->rings[this->side_].empty() ? 0 : 1, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (descriptor < 0x0) { std::printf("[Robomaster]: failed to create loopback eventfd\n"); return -1; }
+        event.store(descriptor); return descriptor;
+    }
+
+    SendStatus LoopbackBus::send_frames(const std::span<const can_frame> frames, size_t& sent) {
+        auto& ring = this->channel_->rings[1 - this->side_]; const auto now = std::chrono::system_clock::now();
+        sent = 0x0; for (const auto& frame : frames) { if (!ring.push(Frame{frame, now})) { break; } sent++; }
+        if (const auto descriptor = this->channel_->events[1 - this->side_].load(); descriptor >= 0x0) { constexpr uint64_t value = 1; [[maybe_unused]] const auto result = write(descriptor, &value, sizeof(value)); }
+        return sent == frames.size() ? SEND_STATUS_SENT : SEND_STATUS_BUSY;
+    }
+
+    bool LoopbackBus::read_frames(const std::span<can_frame> frames, const std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) {
+        auto& ring = this->channel_->rings[this->side_]; const auto length = std::min(frames.size(), timestamps.size());
+        const auto deadline = std::chrono::steady_clock::now() + this->timeout_; count = 0x0;
+        if (const auto descriptor = this->channel_->events[this->side_].load(); descriptor >= 0x0) { uint64_t value = 0; [[maybe_unused]] const auto result = read(descriptor, &value, sizeof(value)); }
+        for (size_t spin = 0; count == 0x0; spin++) {
+            Frame frame{};
+            while (count < length && ring.pop(frame)) {
+                frame.frame.can_id = frame.frame.can_id & CAN_EFF_FLAG ? frame.frame.can_id & CAN_EFF_MASK: frame.frame.can_id & CAN_SFF_MASK;
+                if (!this->filter_.empty() && std::ranges::find(this->filter_, frame.frame.can_id) == this->filter_.end()) { continue; }
+                frames[count] = frame.frame; timestamps[count] = frame.timestamp; count++;
+            }
+            if (count != 0x0) { break; } if (std::chrono::steady_clock::now() >= deadline) { return true; }
+            if (spin < STD_SPIN_COUNT) { std::this_thread::yield(); } else { std::this_thread::sleep_for(STD_POLL_INTERVAL); }
+        }
+        if (const auto descriptor = this->channel_->events[this->side_].load(); descriptor >= 0x0 && !ring.empty()) { constexpr uint64_t value = 1; [[maybe_unused]] const auto result = write(descriptor, &value, sizeof(value)); }
+        return true;
+    }
+} // namespace robomaster
@@ -22,19 +22,20 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <string>
 
 #include "robomaster/message.h"
 #include "robomaster/utils.h"
 
 namespace robomaster {
-    Message::Message(const uint32_t device_id, const std::vector<uint8_t>& message_data): is_valid_{false}, device_id_{device_id}, sequence_{}, type_{} {
+    Message::Message(const uint32_t device_id, const std::span<const uint8_t> message_data): is_valid_{false}, device_id_{device_id}, sequence_{}, type_{}, length_{}, payload_{} {
         if (message_data.size() <= 10) { return; }
         this->type_ = get_little_endian(message_data[4], message_data[5]);
         this->sequence_ = get_little_endian(message_data[6], message_data[7]);
-        this->payload_.clear();
-        this->payload_.insert(std::begin(this->payload_), std::cbegin(message_data) + 8, std::cend(message_data) - 2);
+        this->set_payload(message_data.subspan(8, message_data.size() - 10));
         this->is_valid_ = true;
     }
 
@@ -42,7 +43,15 @@ namespace robomaster {
         const uint32_t device_id,
         const uint16_t device_type,
         const uint16_t sequence,
-        std::vector<uint8_t> payload): is_valid_{true}, device_id_{device_id}, sequence_{sequence}, type_{device_type}, payload_{std::move(payload)} {
+        const std::span<const uint8_t> payload): is_valid_{true}, device_id_{device_id}, sequence_{sequence}, type_{device_type}, length_{}, payload_{} {
+        this->set_payload(payload);
+    }
+
+    Message::Message(
+        const uint32_t device_id,
+        const uint16_t device_type,
+        const uint16_t sequence,
+        const std::initializer_list<uint8_t> payload): Message(device_id, device_type, sequence, std::span{payload.begin(), payload.size()}) {
     }
 
     bool Message::is_valid() const {
@@ -61,28 +70,28 @@ namespace robomaster {
         return this->type_;
     }
 
-    std::vector<uint8_t> Message::get_payload() const {
-        return this->payload_;
+    std::span<const uint8_t> Message::get_payload() const {
+        return std::span{this->payload_.data(), this->length_};
     }
 
     size_t Message::get_length() const {
-        return this->payload_.size() + 10;
+        return this->length_ + 10;
     }
 
     uint8_t Message::get_uint8(const size_t index) const {
-        assert(index < this->payload_.size());
+        assert(index < this->length_);
         return this->payload_[index];
     }
 
     uint16_t Message::get_uint16(const size_t index) const {
-        assert(index + 1 < this->payload_.size());
+        assert(index + 1 < this->length_);
         uint16_t value = this->payload_[index + 1];
         value = value << 8 | this->payload_[index];
         return value;
     }
 
     uint32_t Message::get_uint32(const size_t index) const {
-        assert(index + 3 < this->payload_.size());
+        assert(index + 3 < this->length_);
         uint32_t value = this->payload_[index + 3];
         value = value << 8 | this->payload_[index + 2];
         value = value << 8 | this->payload_[index + 1];
@@ -91,19 +100,19 @@ namespace robomaster {
     }
 
     int8_t Message::get_int8(const size_t index) const {
-        assert(index < this->payload_.size());
+        assert(index < this->length_);
         return static_cast<int8_t>(this->payload_[index]);
     }
 
     int16_t Message::get_int16(const size_t index) const {
-        assert(index + 1 < this->payload_.size());
+        assert(index + 1 < this->length_);
         int16_t value = this->payload_[index + 1];
         value = static_cast<int16_t>(value << 8 | this->payload_[index]);
         return value;
     }
 
     int32_t Message::get_int32(const size_t index) const {
-        assert(index + 3 < this->payload_.size());
+        assert(index + 3 < this->length_);
         int32_t value = this->payload_[index + 3];
         value = value << 8 | this->payload_[index + 2];
         value = value << 8 | this->payload_[index + 1];
@@ -112,33 +121,47 @@ namespace robomaster {
     }
 
     float Message::get_float(const size_t index) const {
-        assert(index + 3 < this->payload_.size());
+        assert(index + 3 < this->length_);
         union { uint32_t input; float output; } store_{};
         store_.input = this->get_uint32(index);
         return store_.output;
     }
 
+    std::chrono::system_clock::time_point Message::get_first_timestamp() const {
+        return this->first_timestamp_;
+    }
+
+    std::chrono::system_clock::time_point Message::get_last_timestamp() const {
+        return this->last_timestamp_;
+    }
+
+    void Message::set_timestamps(const std::chrono::system_clock::time_point first, const std::chrono::system_clock::time_point last) {
+        this->first_timestamp_ = first;
+        this->last_timestamp_ = last;
+    }
+
     void Message::set_type(const uint16_t type) {
         this->type_ = type;
     }
 
-    void Message::set_payload(const std::vector<uint8_t>& payload) {
-        this->payload_ = payload;
+    void Message::set_payload(const std::span<const uint8_t> payload) {
+        this->length_ = static_cast<uint8_t>(std::min(payload.size(), STD_MAX_PAYLOAD_LENGTH));
+        std::memcpy(this->payload_.data(), payload.data(), this->length_);
     }
 
     void Message::set_uint8(const size_t index, const uint8_t value) {
-        assert(index < this->payload_.size());
+        assert(index < this->length_);
         this->payload_[index] = value;
     }
 
     void Message::set_uint16(const size_t index, const uint16_t value) {
-        assert(index + 1 < this->payload_.size());
+        assert(index + 1 < this->length_);
         this->payload_[index] = static_cast<uint8_t>(value);
         this->payload_[index + 1] = static_cast<uint8_t>(value >> 8);
     }
 
     void Message::set_uint32(const size_t index, const uint32_t value) {
-        assert(index + 3 < this->payload_.size());
+        assert(index + 3 < this->length_);
         this->payload_[index] = static_cast<uint8_t>(value);
         this->payload_[index + 1] = static_cast<uint8_t>(value >> 8);
         this->payload_[index + 2] = static_cast<uint8_t>(value >> 16);
@@ -146,18 +169,18 @@ namespace robomaster {
     }
 
     void Message::set_int8(const size_t index, const int8_t value) {
-        assert(index < this->payload_.size());
+        assert(index < this->length_);
         this->payload_[index] = value;
     }
 
     void Message::set_int16(const size_t index, const int16_t value) {
-        assert(index + 1 < this->payload_.size());
+        assert(index + 1 < this->length_);
         this->payload_[index] = static_cast<uint8_t>(value);
         this->payload_[index + 1] = static_cast<uint8_t>(value >> 8);
     }
 
     void Message::set_int32(const size_t index, const int32_t value) {
-        assert(index + 3 < this->payload_.size());
+        assert(index + 3 < this->length_);
         this->payload_[index] = static_cast<uint8_t>(value);
         this->payload_[index + 1] = static_cast<uint8_t>(value >> 8);
         this->payload_[index + 2] = static_cast<uint8_t>(value >> 16);
@@ -165,31 +188,35 @@ namespace robomaster {
     }
 
     void Message::set_float(const size_t index, const float value) {
-        assert(index + 3 < this->payload_.size());
+        assert(index + 3 < this->length_);
         union { float input; uint32_t output; } store_{};
         store_.input = value;
         this->set_uint32(index, store_.output);
     }
 
+    size_t Message::encode(const std::span<uint8_t> buffer) const {
+        const auto length = this->get_length();
+        if (!this->is_valid_ || buffer.size() < length) { return 0x0; }
+
+        buffer[0] = 0x55;
+        buffer[1] = static_cast<uint8_t>(length);
+        buffer[2] = 0x04;
+        buffer[3] = get_crc8(buffer.data(), 3);
+        buffer[4] = static_cast<uint8_t>(this->type_);
+        buffer[5] = static_cast<uint8_t>(this->type_ >> 8);
+        buffer[6] = static_cast<uint8_t>(this->sequence_);
+        buffer[7] = static_cast<uint8_t>(this->sequence_ >> 8);
+
+        std::memcpy(buffer.data() + 8, this->payload_.data(), this->length_);
+        const uint16_t crc16 = get_crc16(buffer.data(), length - 2);
+
+        buffer[length - 2] = static_cast<uint8_t>(crc16);
+        buffer[length - 1] = static_cast<uint8_t>(crc16 >> 8);
+        return length;
+    }
+
     std::vector<uint8_t> Message::vector() const {
-        std::vector<uint8_t> vector;
-        if (!this->is_valid_) { return vector; }
-
-        vector.resize(10 + this->payload_.size());
-        vector[0] = 0x55;
-        vector[1] = static_cast<uint8_t>(vector.size());
-        vector[2] = 0x04;
-        vector[3] = get_crc8(vector.data(), 3);
-        vector[4] = static_cast<uint8_t>(this->type_);
-        vector[5] = static_cast<uint8_t>(this->type_ >> 8);
-        vector[6] = static_cast<uint8_t>(this->sequence_);
-        vector[7] = static_cast<uint8_t>(this->sequence_ >> 8);
-
-        for (size_t i = 0; i < this->payload_.size(); i++) { vector[8 + i] = this->payload_[i]; }
-        const uint16_t crc16 = get_crc16(vector.data(), vector.size() - 2);
-
-        vector[vector.size() - 2] = static_cast<uint8_t>(crc16);
-        vector[vector.size() - 1] = static_cast<uint8_t>(crc16 >> 8);
-        return vector;
+        std::vector<uint8_t> vector(this->is_valid_ ? this->get_length() : 0x0);
+        this->encode(vector); return vector;
     }
 } // namespace robomaster
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <array>
+
+#include "robomaster/pacer.h"
+
+namespace robomaster {
+    static constexpr uint16_t STD_CRC15_POLYNOMIAL = 0x4599;
+    static constexpr size_t STD_STUFF_LENGTH = 5;
+    static constexpr size_t STD_FRAME_TRAILER = 13;
+
+    Pacer::Pacer(): Pacer(STD_DEFAULT_BITRATE, 0.0, std::chrono::nanoseconds::zero()) { }
+
+    Pacer::Pacer(const uint32_t bitrate, const double share, const std::chrono::nanoseconds depth):
+        bit_time_{1e9 / std::max<uint32_t>(bitrate, 1)}, share_{std::clamp(share, 0.0, 1.0)}, depth_{depth}, full_{} { }
+
+    size_t Pacer::frame_bits(const can_frame& frame) {
+        std::array<uint8_t, 128> bits{}; size_t count = 0x0; const auto length = std::min<size_t>(frame.can_dlc, CAN_MAX_DLEN);
+        const auto append = [&bits, &count](const uint32_t value, const size_t width) { for (size_t i = width; i-- > 0;) { bits[count++] = value >> i & 0x1; } };
+        append(0x0, 1);
+        if (frame.can_id & CAN_EFF_FLAG) { const auto id = frame.can_id & CAN_EFF_MASK; append(id >> 18, 11); append(0x3, 2); append(id, 18); append(0x0, 3); }
+        else { append(frame.can_id & CAN_SFF_MASK, 11); append(0x0, 3); }
+        append(static_cast<uint32_t>(length), 4); for (size_t i = 0; i < length; i++) { append(frame.data[i], 8); }
+
+        uint16_t crc = 0x0;
+        for (size_t i = 0; i < count; i++) { const bool next = bits[i] ^ (crc >> 14 & 0x1); crc = crc << 1 & 0x7fff; if (next) { crc ^= STD_CRC15_POLYNOMIAL; } }
+        append(crc, 15);
+
+        size_t stuffed = 0x0, run = 0x0; uint8_t previous = 0x0;
+        for (size_t i = 0; i < count; i++) {
+            if (run != 0x0 && bits[i] == previous) { run++; } else { previous = bits[i]; run = 1; }
+            if (run == STD_STUFF_LENGTH) { stuffed++; previous ^= 0x1; run = 1; }
+        } return count + stuffed + STD_FRAME_TRAILER;
+    }
+
+    std::chrono::nanoseconds Pacer::bus_time(const std::span<const can_frame> frames) const {
+        size_t bits = 0x0; for (const auto& frame : frames) { bits += frame_bits(frame); }
+        return std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(bits) * this->bit_time_));
+    }
+
+    bool Pacer::is_ready(const std::chrono::steady_clock::time_point now) const {
+        return now >= this->ready_time();
+    }
+
+    std::chrono::steady_clock::time_point Pacer::ready_time() const {
+        return this->full_ - this->depth_;
+    }
+
+    void Pacer::consume(const std::span<const can_frame> frames, const std::chrono::steady_clock::time_point now) {
+        if (this->share_ == 0.0) { return; }
+        this->full_ = std::max(this->full_, now) + std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(this->bus_time(frames).count()) / this->share_));
+    }
+} // namespace robomaster
@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "robomaster/parser.h"
+#include "robomaster/utils.h"
+
+namespace robomaster {
+    static constexpr uint8_t STD_START_BYTE = 0x55;
+    static constexpr size_t STD_HEADER_LENGTH = 4;
+    static constexpr size_t STD_MIN_MESSAGE_LENGTH = 11;
+    static constexpr size_t STD_VECTOR_SIZE = 16;
+    static constexpr size_t STD_WORD_SIZE = 8;
+    static constexpr uint64_t STD_WORD_LOW = 0x7f7f7f7f7f7f7f7f;
+    static constexpr uint64_t STD_WORD_START = 0x5555555555555555;
+
+    /**
+     * @brief Check if the candidate at the given position starts a header, a candidate without the full header is accepted.
+     */
+    static bool is_header(const std::span<const uint8_t> data, const size_t position) {
+        if (position + STD_HEADER_LENGTH > data.size()) { return true; }
+        return data[position + 1] >= STD_MIN_MESSAGE_LENGTH && data[position + 3] == get_crc8(data.data() + position, 3);
+    }
+
+    /**
+     * @brief Check the candidates of a block, the mask has a lane of stride bits per byte which is non-zero for a start byte.
+     */
+    template<size_t stride>
+    static size_t find_candidate(const std::span<const uint8_t> data, const size_t index, uint64_t mask, size_t& rejected) {
+        while (mask != 0x0) {
+            const auto position = index + static_cast<size_t>(std::countr_zero(mask)) / stride; if (is_header(data, position)) { return position; } rejected++;
+            mask &= ~((~uint64_t{} >> (64 - stride)) << (position - index) * stride);
+        } return data.size();
+    }
+
+    /**
+     * @brief Find the first header in the data, 16 bytes at a time with SSE2 or NEON, then 8 bytes at a time within a word.
+     */
+    static size_t find_header(const std::span<const uint8_t> data, size_t index, size_t& rejected) {
+#if defined(__SSE2__) || defined(__ARM_NEON)
+        for (; index + STD_VECTOR_SIZE <= data.size(); index += STD_VECTOR_SIZE) {
+#if defined(__SSE2__)
+            const auto equal = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index)), _mm_set1_epi8(STD_START_BYTE));
+            const auto position = find_candidate<1>(data, index, static_cast<uint32_t>(_mm_movemask_epi8(equal)), rejected);
+#else
+            const auto equal = vceqq_u8(vld1q_u8(data.data() + index), vdupq_n_u8(STD_START_BYTE));
+            const auto position = find_candidate<4>(data, index, vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0), rejected);
+#endif
+            if (position != data.size()) { return position; }
+        }
+#endif
+        for (; index + STD_WORD_SIZE <= data.size(); index += STD_WORD_SIZE) {
+            uint64_t word; std::memcpy(&word, data.data() + index, STD_WORD_SIZE); word ^= STD_WORD_START;
+            if constexpr (std::endian::native == std::endian::big) { word = std::byteswap(word); }
+            const auto position = find_candidate<8>(data, index, ~(((word & STD_WORD_LOW) + STD_WORD_LOW) | word | STD_WORD_LOW), rejected);
+            if (position != data.size()) { return position; }
+        }
+        for (; index < data.size(); index++) { if (data[index] == STD_START_BYTE) { if (is_header(data, index)) { return index; } rejected++; } }
+        return data.size();
+    }
+
+    StreamParser::StreamParser(): buffer_{}, size_{}, length_{}, crc_{} { }
+
+    void StreamParser::reset() {
+        this->size_ = 0x0; this->length_ = 0x0;
+    }
+
+    void StreamParser::resync() {
+        const auto begin = this->buffer_.begin() + 1, end = this->buffer_.begin() + static_cast<long>(this->size_);
+        const auto start = std::find(begin, end, STD_START_BYTE);
+        this->header_failures_.add(); this->bytes_discarded_.add(static_cast<uint64_t>(start - this->buffer_.begin()));
+        this->size_ = static_cast<size_t>(end - start); std::memmove(this->buffer_.data(), &*start, this->size_);
+    }
+
+    ParserStats StreamParser::stats() const {
+        return ParserStats{this->header_failures_.load(), this->checksum_failures_.load(), this->bytes_discarded_.load()};
+    }
+
+    size_t StreamParser::parse(const std::span<const uint8_t> data, const std::chrono::system_clock::time_point time, std::span<const uint8_t>& message) {
+        size_t index = 0x0; message = {};
+        while (index < data.size()) {
+            if (this->size_ == 0x0) {
+                size_t rejected = 0x0; const auto position = find_header(data, index, rejected);
+                if (rejected != 0x0) { this->header_failures_.add(rejected); } if (position != index) { this->bytes_discarded_.add(position - index); }
+                index = position; if (index == data.size()) { break; } this->timestamp_ = time;
+                if (index + STD_HEADER_LENGTH <= data.size()) {
+                    std::memcpy(this->buffer_.data(), data.data() + index, STD_HEADER_LENGTH); this->size_ = STD_HEADER_LENGTH; this->length_ = this->buffer_[1]; index += STD_HEADER_LENGTH;
+                    this->crc_ = update_crc16(STD_CRC16_SEED, this->buffer_.data(), STD_HEADER_LENGTH); continue;
+                }
+            }
+            if (this->length_ == 0x0) {
+                this->buffer_[this->size_++] = data[index++]; if (this->size_ < STD_HEADER_LENGTH) { continue; }
+                if (this->buffer_[3] != get_crc8(this->buffer_.data(), 3) || this->buffer_[1] < STD_MIN_MESSAGE_LENGTH) { this->resync(); continue; }
+                this->length_ = this->buffer_[1]; this->crc_ = update_crc16(STD_CRC16_SEED, this->buffer_.data(), STD_HEADER_LENGTH); continue;
+            }
+            const auto count = std::min(this->length_ - this->size_, data.size() - index), covered = this->length_ - 2;
+            std::memcpy(this->buffer_.data() + this->size_, data.data() + index, count);
+            if (this->size_ < covered) { this->crc_ = update_crc16(this->crc_, data.data() + index, std::min(count, covered - this->size_)); }
+            this->size_ += count; index += count; if (this->size_ < this->length_) { continue; }
+
+            const auto length = this->length_; this->reset();
+            if (this->crc_ == get_little_endian(this->buffer_[length - 2], this->buffer_[length - 1])) { message = std::span{this->buffer_.data(), length}; break; }
+            this->checksum_failures_.add(); this->bytes_discarded_.add(length);
+        } return index;
+    }
+} // namespace robomaster
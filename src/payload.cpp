@@ -36,21 +36,6 @@ namespace robomaster {
     const uint16_t Payload::DEVICE_TYPE_BLASTER = 0x17c9;
     const uint16_t Payload::DEVICE_TYPE_LED = 0x18c9;
 
-    const uint16_t Payload::DEVICE_ID_INTELLI_CONTROLLER = 0x201;
-    const uint16_t Payload::DEVICE_ID_MOTION_CONTROLLER = 0x202;
-    const uint16_t Payload::DEVICE_ID_GIMBAL = 0x203;
-    const uint16_t Payload::DEVICE_ID_HIT_DETECTOR_1 = 0x211;
-    const uint16_t Payload::DEVICE_ID_HIT_DETECTOR_2 = 0x212;
-    const uint16_t Payload::DEVICE_ID_HIT_DETECTOR_3 = 0x213;
-    const uint16_t Payload::DEVICE_ID_HIT_DETECTOR_4 = 0x214;
-
-    const uint16_t Payload::DEVICE_RC_TYPE_MOTION_CONTROLLER = 0x0903;
-    const uint16_t Payload::DEVICE_RC_TYPE_GIMBAL = 0x0904;
-    const uint16_t Payload::DEVICE_RC_TYPE_HIT_DETECTOR_1 = 0x0938;
-    const uint16_t Payload::DEVICE_RC_TYPE_HIT_DETECTOR_2 = 0x0958;
-    const uint16_t Payload::DEVICE_RC_TYPE_HIT_DETECTOR_3 = 0x0978;
-    const uint16_t Payload::DEVICE_RC_TYPE_HIT_DETECTOR_4 = 0x0998;
-
     const std::vector<uint8_t> Payload::BOOT_CHASSIS_SPECIAL = { 0x40, 0x48, 0x04, 0x00, 0x09, 0x00 };
     const std::vector<uint8_t> Payload::BOOT_CHASSIS_CONFIRM = { 0x40, 0x48, 0x01, 0x09, 0x00, 0x00, 0x00, 0x03 };
     const std::vector<uint8_t> Payload::BOOT_CHASSIS_INFO = {
@@ -77,11 +62,4 @@ namespace robomaster {
     const std::vector<uint8_t> Payload::BLASTER_MODE_LED = { 0x00, 0x3f, 0x55, 0x73, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00 };
     const std::vector<uint8_t> Payload::LED_MODE = { 0x00, 0x3f, 0x32, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
     const std::vector<uint8_t> Payload::HEART_BEAT = { 0x00, 0x3f, 0x60, 0x00, 0x04, 0x20, 0x00, 0x01, 0x00, 0x40, 0x00, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00 };
-
-    const std::vector<uint8_t> Payload::MESSAGE_MOTION_CONTROLLER = { 0x20, 0x48, 0x08, 0x00 };
-    const std::vector<uint8_t> Payload::MESSAGE_GIMBAL = { 0x00, 0x3f, 0x76 };
-    const std::vector<uint8_t> Payload::MESSAGE_HIT_DETECTOR_1 = { 0x00, 0x3f, 0x02, 0x10 };
-    const std::vector<uint8_t> Payload::MESSAGE_HIT_DETECTOR_2 = { 0x00, 0x3f, 0x02, 0x20 };
-    const std::vector<uint8_t> Payload::MESSAGE_HIT_DETECTOR_3 = { 0x00, 0x3f, 0x02, 0x30 };
-    const std::vector<uint8_t> Payload::MESSAGE_HIT_DETECTOR_4 = { 0x00, 0x3f, 0x02, 0x40 };
 } // namespace robomaster
\ No newline at end of file
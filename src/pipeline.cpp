@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "robomaster/pipeline.h"
+
+namespace robomaster {
+    static constexpr auto STD_MEMORY_ORDER = std::memory_order::relaxed;
+
+    Pipeline::Pipeline(): sequence_{}, max_depth_{}, is_stopped_{false} { }
+
+    Pipeline::~Pipeline() {
+        this->stop();
+    }
+
+    bool Pipeline::init(std::function<void(const RawMessage&)> consumer, const ThreadConfig& config) {
+        this->consumer_ = std::move(consumer); this->thread_ = std::thread{&Pipeline::run, this};
+        if (!set_thread_config(this->thread_, config)) { this->stop(); return false; }
+        return true;
+    }
+
+    bool Pipeline::push(const size_t index, const uint32_t device_id, const std::span<const uint8_t> data, const std::chrono::system_clock::time_point first, const std::chrono::system_clock::time_point last) {
+        RawMessage message{index, device_id, std::min(data.size(), STD_MAX_MESSAGE_LENGTH), first, last, {}}; std::memcpy(message.data.data(), data.data(), message.length);
+        if (!this->ring_.push(message)) { this->messages_dropped_.add(); return false; }
+        if (const auto depth = this->ring_.size(); depth > this->max_depth_.load(STD_MEMORY_ORDER)) { this->max_depth_.store(depth, STD_MEMORY_ORDER); }
+        this->sequence_.fetch_add(1, std::memory_order::release); this->sequence_.notify_one(); return true;
+    }
+
+    void Pipeline::stop() {
+        this->is_stopped_.store(true, STD_MEMORY_ORDER); this->sequence_.fetch_add(1, std::memory_order::release); this->sequence_.notify_one();
+        if (this->thread_.joinable() && std::this_thread::get_id() != this->thread_.get_id()) { this->thread_.join(); }
+    }
+
+    PipelineStats Pipeline::stats() const {
+        return PipelineStats{this->ring_.size(), this->max_depth_.load(STD_MEMORY_ORDER), this->ring_.capacity(), this->messages_dropped_.load()};
+    }
+
+    void Pipeline::run() {
+        RawMessage message{};
+        while (true) {
+            const auto sequence = this->sequence_.load(std::memory_order::acquire);
+            while (this->ring_.pop(message)) { this->consumer_(message); }
+            if (this->is_stopped_.load(STD_MEMORY_ORDER)) { break; }
+            this->sequence_.wait(sequence, std::memory_order::acquire);
+        }
+    }
+} // namespace robomaster
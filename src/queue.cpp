@@ -22,38 +22,55 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "robomaster/queue.h"
 
 namespace robomaster {
-    static constexpr size_t STD_MAX_QUEUE_SIZE = 10;
+    template <size_t... I>
+    static std::array<MPMCRing<Message, STD_MAX_QUEUE_SIZE>, COMMAND_CLASS_COUNT> make_lanes(const Message& message, std::index_sequence<I...>) {
+        return { ((void)I, MPMCRing<Message, STD_MAX_QUEUE_SIZE>(message))... };
+    }
+
+    Queue::Queue(): lanes_{make_lanes(Message(0x0, {}), std::make_index_sequence<COMMAND_CLASS_COUNT>{})} {
+        this->set_capacity(STD_QUEUE_CAPACITY);
+    }
 
-    Queue::Queue() = default;
+    void Queue::set_capacity(const std::array<size_t, COMMAND_CLASS_COUNT>& capacity) {
+        for (size_t i = 0; i < COMMAND_CLASS_COUNT; i++) { this->lanes_[i].resize(capacity[i]); }
+    }
 
-    size_t Queue::size() {
-        std::lock_guard lock{this->mutex_};
-        return this->queue_.size();
+    size_t Queue::size() const {
+        size_t size = 0x0; for (const auto& lane : this->lanes_) { size += lane.size(); } return size;
     }
 
-    bool Queue::empty() {
-        std::lock_guard lock{this->mutex_};
-        return this->queue_.empty();
+    bool Queue::empty() const {
+        return std::ranges::all_of(this->lanes_, [](const auto& lane) { return lane.empty(); });
     }
 
     void Queue::clear() {
-        std::lock_guard lock{this->mutex_};
-        while(!this->queue_.empty()) { this->queue_.pop(); }
+        for (auto& lane : this->lanes_) { while (lane.discard()) { } }
     }
 
     Message Queue::pop() {
-        std::lock_guard lock{this->mutex_};
-        if (this->queue_.empty()) { const auto msg = Message(0x0, {}); return msg; }
-        const Message msg = queue_.front();
-        this->queue_.pop(); return msg;
+        auto msg = Message(0x0, {}); this->pop(msg); return msg;
+    }
+
+    bool Queue::pop(Message& message) {
+        CommandClass command_class{}; return this->pop(message, command_class);
+    }
+
+    bool Queue::pop(Message& message, CommandClass& command_class) {
+        for (size_t i = 0; i < COMMAND_CLASS_COUNT; i++) { if (this->lanes_[i].pop(message)) { command_class = static_cast<CommandClass>(i); return true; } } return false;
+    }
+
+    bool Queue::is_superseded(const CommandClass command_class) const {
+        const auto& lane = this->lanes_[command_class]; return lane.capacity() == 1 && !lane.empty();
     }
 
-    void Queue::push(const Message& message) {
-        std::lock_guard lock{this->mutex_};
-        if (STD_MAX_QUEUE_SIZE <= this->queue_.size()) { this->queue_.pop(); }
-        this->queue_.push(message);
+    bool Queue::push(const Message& message, const CommandClass command_class) {
+        auto& lane = this->lanes_[command_class]; bool is_dropped = false;
+        while (!lane.push(message)) { lane.discard(); is_dropped = true; }
+        return !is_dropped || lane.capacity() == 1;
     }
-} // namespace robomaster
\ No newline at end of file
+} // namespace robomaster
@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <span>
+#include <unistd.h>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "robomaster/reactor.h"
+
+namespace robomaster {
+    static constexpr size_t STD_MAX_EVENTS = 16;
+    static constexpr auto STD_MEMORY_ORDER = std::memory_order::relaxed;
+
+    Reactor::Reactor(): epoll_{-1}, event_{-1}, is_stopped_{false} { }
+
+    Reactor::~Reactor() {
+        this->stop();
+        if (this->event_ >= 0x0) { close(this->event_); }
+        if (this->epoll_ >= 0x0) { close(this->epoll_); }
+    }
+
+    bool Reactor::init(const ThreadConfig& config) {
+        this->epoll_ = epoll_create1(EPOLL_CLOEXEC);
+        if (this->epoll_ < 0x0) { std::printf("[Robomaster]: failed to create epoll\n"); return false; }
+        this->event_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (this->event_ < 0x0) { std::printf("[Robomaster]: failed to create eventfd\n"); return false; }
+
+        epoll_event event{}; event.events = EPOLLIN; event.data.fd = this->event_;
+        if (epoll_ctl(this->epoll_, EPOLL_CTL_ADD, this->event_, &event) < 0x0) { std::printf("[Robomaster]: failed to register eventfd\n"); return false; }
+        this->thread_ = std::thread{&Reactor::run, this};
+        if (!set_thread_config(this->thread_, config)) { this->stop(); return false; }
+        return true;
+    }
+
+    bool Reactor::add(const int descriptor, std::function<void(uint32_t)> callback) {
+        std::unique_lock lock{this->mutex_, std::defer_lock}; if (std::this_thread::get_id() != this->thread_.get_id()) { lock.lock(); }
+        epoll_event event{}; event.events = EPOLLIN; event.data.fd = descriptor;
+        if (epoll_ctl(this->epoll_, EPOLL_CTL_ADD, descriptor, &event) < 0x0) { std::printf("[Robomaster]: failed to register descriptor\n"); return false; }
+        std::erase(this->removed_, descriptor); this->callbacks_.insert_or_assign(descriptor, std::move(callback));
+        return true;
+    }
+
+    void Reactor::remove(const int descriptor) {
+        if (std::this_thread::get_id() == this->thread_.get_id()) { epoll_ctl(this->epoll_, EPOLL_CTL_DEL, descriptor, nullptr); this->removed_.push_back(descriptor); return; }
+        std::lock_guard lock{this->mutex_};
+        epoll_ctl(this->epoll_, EPOLL_CTL_DEL, descriptor, nullptr); this->callbacks_.erase(descriptor);
+    }
+
+    void Reactor::stop() {
+        this->is_stopped_.store(true, STD_MEMORY_ORDER);
+        if (this->event_ >= 0x0) { constexpr uint64_t value = 1; [[maybe_unused]] const auto result = write(this->event_, &value, sizeof(value)); }
+        if (this->thread_.joinable() && std::this_thread::get_id() != this->thread_.get_id()) { this->thread_.join(); }
+    }
+
+    void Reactor::run() {
+        std::array<epoll_event, STD_MAX_EVENTS> events{};
+        while (!this->is_stopped_.load(STD_MEMORY_ORDER)) {
+            const auto count = epoll_wait(this->epoll_, events.data(), static_cast<int>(events.size()), -1);
+            if (count < 0x0) { if (errno == EINTR) { continue; } std::printf("[Robomaster]: failed to wait for epoll\n"); break; }
+
+            std::lock_guard lock{this->mutex_};
+            for (const auto& event : std::span{events.data(), static_cast<size_t>(count)}) {
+                if (event.data.fd == this->event_ || std::ranges::find(this->removed_, event.data.fd) != this->removed_.end()) { continue; }
+                if (const auto callback = this->callbacks_.find(event.data.fd); callback != this->callbacks_.end()) { callback->second(event.events); }
+                if (this->is_stopped_.load(STD_MEMORY_ORDER)) { break; }
+            }
+            for (const auto descriptor : this->removed_) { this->callbacks_.erase(descriptor); } this->removed_.clear();
+        }
+    }
+} // namespace robomaster
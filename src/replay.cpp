@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+#include "robomaster/replay.h"
+
+namespace robomaster {
+    ReplayBus::ReplayBus(const bool realtime): realtime_{realtime}, timeout_{0}, is_finished_{false} { }
+
+    bool ReplayBus::init(const std::string& interface) {
+        this->file_.open(interface);
+        if (!this->file_.is_open()) { std::printf("[Robomaster]: failed to open replay file %s\n", interface.c_str()); return false; }
+        return true;
+    }
+
+    void ReplayBus::set_timeout(const double seconds) {
+        this->timeout_ = std::chrono::microseconds(static_cast<long>(std::max(seconds, 0.0) * 1e6));
+    }
+
+    bool ReplayBus::set_filter(const std::span<const uint32_t> device_ids) {
+        this->filter_.assign(device_ids.begin(), device_ids.end());
+        return true;
+    }
+
+    int ReplayBus::get_descriptor() {
+        return -1;
+    }
+
+    SendStatus ReplayBus::send_frames(const std::span<const can_frame> frames, size_t& sent) {
+        sent = frames.size(); return SEND_STATUS_SENT;
+    }
+
+    std::optional<ReplayBus::Frame> ReplayBus::next_frame() {
+        const auto hex = [](const std::string_view text, auto& value) { return std::from_chars(text.data(), text.data() + text.size(), value, 16).ec == std::errc{}; };
+        std::string line;
+        while (std::getline(this->file_, line)) {
+            std::istringstream stream{line}; std::string time, interface, content; if (!(stream >> time >> interface >> content)) { continue; }
+            const auto dot = time.find('.'); const auto split = content.find('#');
+            if (time.size() < 4 || time.front() != '(' || time.back() != ')' || dot == std::string::npos || split == std::string::npos) { continue; }
+            const auto data = std::string_view{content}.substr(split + 1); if (data.starts_with('#') || data.starts_with('R') || data.size() % 2 != 0 || data.size() > 16) { continue; }
+
+            long seconds = 0, fraction = 0; const auto digits = time.size() - dot - 2;
+            std::from_chars(time.data() + 1, time.data() + dot, seconds); std::from_chars(time.data() + dot + 1, time.data() + time.size() - 1, fraction);
+            Frame frame{}; uint32_t id = 0; if (!hex(std::string_view{content}.substr(0, split), id)) { continue; }
+            frame.frame.can_id = split > 3 ? id & CAN_EFF_MASK : id & CAN_SFF_MASK; frame.frame.can_dlc = data.size() / 2;
+            for (size_t i = 0; i < frame.frame.can_dlc; i++) { if (!hex(data.substr(i * 2, 2), frame.frame.data[i])) { frame.frame.can_dlc = 0; } }
+            frame.timestamp = std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::seconds{seconds} + std::chrono::nanoseconds{static_cast<long>(static_cast<double>(fraction) * std::pow(10.0, 9.0 - static_cast<double>(digits)))})};
+            if (!this->filter_.empty() && (split > 3 || std::ranges::find(this->filter_, frame.frame.can_id) == this->filter_.end())) { continue; }
+            return frame;
+        } return std::nullopt;
+    }
+
+    bool ReplayBus::read_frames(const std::span<can_frame> frames, const std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) {
+        const auto length = std::min(frames.size(), timestamps.size()); count = 0x0;
+        while (count < length) {
+            if (!this->pending_) { this->pending_ = this->next_frame(); } if (!this->pending_) { break; }
+            if (this->realtime_) {
+                if (!this->origin_) { this->origin_.emplace(std::chrono::steady_clock::now(), this->pending_->timestamp); }
+                const auto due = this->origin_->first + (this->pending_->timestamp - this->origin_->second);
+                if (const auto now = std::chrono::steady_clock::now(); due > now) {
+                    if (count != 0x0) { break; } if (due - now > this->timeout_) { std::this_thread::sleep_for(this->timeout_); return true; }
+                    std::this_thread::sleep_until(due);
+                }
+            }
+            frames[count] = this->pending_->frame; timestamps[count] = this->pending_->timestamp; this->pending_.reset(); count++;
+        }
+        if (count == 0x0 && !this->is_finished_.exchange(true)) { std::printf("[Robomaster]: end of replay file\n"); }
+        if (count == 0x0) { std::this_thread::sleep_for(this->timeout_); } return true;
+    }
+
+    bool ReplayBus::is_finished() const {
+        return this->is_finished_.load();
+    }
+} // namespace robomaster
@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <pthread.h>
+
+#include <sys/mman.h>
+
+#include "robomaster/scheduling.h"
+
+namespace robomaster {
+    static constexpr size_t STD_MAX_THREAD_NAME = 15;
+
+    bool set_thread_config(std::thread& thread, const ThreadConfig& config) {
+        const auto handle = thread.native_handle(); const auto name = config.name.substr(0, STD_MAX_THREAD_NAME); bool is_applied = true;
+        const auto report = [&name, &is_applied](const char* setting, const int error) {
+            if (error == 0x0) { return; } is_applied = false;
+            std::printf("[Robomaster]: failed to set the %s of the thread%s%s: %s\n", setting, name.empty() ? "" : " ", name.c_str(), std::strerror(error));
+        };
+        if (!name.empty()) { report("name", pthread_setname_np(handle, name.c_str())); }
+        if (config.policy != SCHED_OTHER || config.priority != 0x0) {
+            sched_param parameter{}; parameter.sched_priority = config.priority; report("scheduling", pthread_setschedparam(handle, config.policy, &parameter));
+        }
+        if (!config.cpus.empty()) {
+            cpu_set_t set; CPU_ZERO(&set);
+            for (const auto cpu : config.cpus) { if (cpu < CPU_SETSIZE) { CPU_SET(cpu, &set); } else { report("affinity", EINVAL); } }
+            if (CPU_COUNT(&set) != 0x0) { report("affinity", pthread_setaffinity_np(handle, sizeof(set), &set)); }
+        } return is_applied;
+    }
+
+    bool lock_memory() {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0x0) { std::printf("[Robomaster]: failed to lock memory: %s\n", std::strerror(errno)); return false; }
+        return true;
+    }
+} // namespace robomaster
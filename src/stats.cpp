@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#include "robomaster/stats.h"
+
+namespace robomaster {
+    static constexpr int64_t STD_SMOOTHING = 16;
+    static constexpr auto STD_MEMORY_ORDER = std::memory_order::relaxed;
+
+    std::chrono::nanoseconds HistogramStats::percentile(const double quantile) const {
+        const auto target = static_cast<uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(this->count))); uint64_t count = 0x0;
+        for (size_t i = 0; i + 1 < this->buckets.size(); i++) {
+            count += this->buckets[i]; if (count >= target && count != 0x0) { return std::min<std::chrono::nanoseconds>(STD_HISTOGRAM_WIDTH * (i + 1), this->max); }
+        } return this->max;
+    }
+
+    Histogram::Histogram(): min_{std::numeric_limits<int64_t>::max()}, max_{} { }
+
+    void Histogram::record(const std::chrono::nanoseconds duration) {
+        const auto value = std::max<int64_t>(duration.count(), 0x0); const auto bucket = std::min<size_t>(static_cast<size_t>(value / std::chrono::nanoseconds(STD_HISTOGRAM_WIDTH).count()), STD_HISTOGRAM_BUCKETS - 1);
+        this->buckets_[bucket].add(); this->sum_.add(static_cast<uint64_t>(value));
+        if (value < this->min_.load(STD_MEMORY_ORDER)) { this->min_.store(value, STD_MEMORY_ORDER); }
+        if (value > this->max_.load(STD_MEMORY_ORDER)) { this->max_.store(value, STD_MEMORY_ORDER); }
+        this->count_.add();
+    }
+
+    HistogramStats Histogram::snapshot() const {
+        HistogramStats stats; for (size_t i = 0; i < STD_HISTOGRAM_BUCKETS; i++) { stats.buckets[i] = this->buckets_[i].load(); stats.count += stats.buckets[i]; }
+        if (stats.count == 0x0) { return stats; }
+        stats.min = std::chrono::nanoseconds(this->min_.load(STD_MEMORY_ORDER)); stats.max = std::chrono::nanoseconds(this->max_.load(STD_MEMORY_ORDER));
+        stats.mean = std::chrono::nanoseconds(static_cast<int64_t>(this->sum_.load() / std::max<uint64_t>(this->count_.load(), 1))); return stats;
+    }
+
+    DeviceCounters::DeviceCounters(): interval_{}, jitter_{}, last_{}, previous_interval_{}, sequence_{} { }
+
+    void DeviceCounters::record(const uint16_t sequence, const std::chrono::system_clock::time_point time) {
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count(); const auto last = this->last_.load(STD_MEMORY_ORDER);
+        if (this->messages_.load() != 0x0) {
+            if (static_cast<uint16_t>(this->sequence_ + 1) != sequence) { this->sequence_gaps_.add(); }
+            const auto interval = now - last, interval_mean = this->interval_.load(STD_MEMORY_ORDER), jitter = this->jitter_.load(STD_MEMORY_ORDER);
+            this->interval_.store(interval_mean == 0x0 ? interval : interval_mean + (interval - interval_mean) / STD_SMOOTHING, STD_MEMORY_ORDER);
+            if (this->previous_interval_ != 0x0) { this->jitter_.store(jitter + (std::abs(interval - this->previous_interval_) - jitter) / STD_SMOOTHING, STD_MEMORY_ORDER); }
+            this->previous_interval_ = interval;
+        }
+        this->sequence_ = sequence; this->last_.store(now, STD_MEMORY_ORDER); this->messages_.add();
+    }
+
+    DeviceStats DeviceCounters::snapshot(const uint32_t device_id) const {
+        DeviceStats stats; stats.device_id = device_id; stats.messages = this->messages_.load(); stats.sequence_gaps = this->sequence_gaps_.load();
+        stats.interval = std::chrono::nanoseconds(this->interval_.load(STD_MEMORY_ORDER)); stats.jitter = std::chrono::nanoseconds(this->jitter_.load(STD_MEMORY_ORDER));
+        stats.last = std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(this->last_.load(STD_MEMORY_ORDER)))};
+        stats.rate = stats.interval.count() > 0x0 ? 1e9 / static_cast<double>(stats.interval.count()) : 0.0; return stats;
+    }
+} // namespace robomaster
@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstring>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "robomaster/uring.h"
+
+namespace robomaster {
+    static constexpr uint32_t STD_RING_ENTRIES = STD_MAX_BATCH_SIZE;
+
+    UringBus::Ring::~Ring() {
+        if (this->sqes != nullptr) { munmap(this->sqes, this->sqes_size); }
+        if (this->cq_memory != nullptr && this->cq_memory != this->sq_memory) { munmap(this->cq_memory, this->cq_size); }
+        if (this->sq_memory != nullptr) { munmap(this->sq_memory, this->sq_size); }
+        if (this->descriptor >= 0x0) { close(this->descriptor); }
+    }
+
+    bool UringBus::Ring::init(const uint32_t entries, const iovec& buffers) {
+        io_uring_params params{}; this->descriptor = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (this->descriptor < 0x0) { std::printf("[Robomaster]: failed to create io_uring\n"); return false; }
+        if (!(params.features & IORING_FEAT_EXT_ARG)) { std::printf("[Robomaster]: io_uring without timeout support\n"); return false; }
+
+        this->sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t); this->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) { this->sq_size = this->cq_size = std::max(this->sq_size, this->cq_size); }
+        auto* sq_memory = mmap(nullptr, this->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->descriptor, IORING_OFF_SQ_RING);
+        if (sq_memory == MAP_FAILED) { std::printf("[Robomaster]: failed to map io_uring\n"); return false; } this->sq_memory = sq_memory;
+        auto* cq_memory = params.features & IORING_FEAT_SINGLE_MMAP ? sq_memory : mmap(nullptr, this->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->descriptor, IORING_OFF_CQ_RING);
+        if (cq_memory == MAP_FAILED) { std::printf("[Robomaster]: failed to map io_uring\n"); return false; } this->cq_memory = cq_memory;
+        this->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        auto* sqes = mmap(nullptr, this->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->descriptor, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) { std::printf("[Robomaster]: failed to map io_uring\n"); return false; } this->sqes = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<uint8_t*>(sq_memory); auto* cq = static_cast<uint8_t*>(cq_memory);
+        this->sq_head = reinterpret_cast<uint32_t*>(sq + params.sq_off.head); this->sq_tail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+        this->sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array); this->sq_mask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+        this->cq_head = reinterpret_cast<uint32_t*>(cq + params.cq_off.head); this->cq_tail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+        this->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes); this->cq_mask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+
+        if (syscall(__NR_io_uring_register, this->descriptor, IORING_REGISTER_BUFFERS, &buffers, 1) < 0x0) { std::printf("[Robomaster]: failed to register io_uring buffers\n"); return false; }
+        return true;
+    }
+
+    void UringBus::Ring::push(const io_uring_sqe& sqe) {
+        const auto tail = *this->sq_tail; const auto index = tail & this->sq_mask;
+        this->sqes[index] = sqe; this->sq_array[index] = index;
+        std::atomic_ref{*this->sq_tail}.store(tail + 1, std::memory_order::release);
+    }
+
+    bool UringBus::Ring::pop(io_uring_cqe& cqe) {
+        const auto head = *this->cq_head; if (head == std::atomic_ref{*this->cq_tail}.load(std::memory_order::acquire)) { return false; }
+        cqe = this->cqes[head & this->cq_mask];
+        std::atomic_ref{*this->cq_head}.store(head + 1, std::memory_order::release); return true;
+    }
+
+    int UringBus::Ring::enter(const uint32_t submit, const uint32_t wait, const __kernel_timespec* timeout) const {
+        io_uring_getevents_arg argument{}; argument.sigmask_sz = _NSIG / 8; argument.ts = reinterpret_cast<uint64_t>(timeout);
+        const uint32_t flags = (wait != 0x0 ? IORING_ENTER_GETEVENTS : 0x0) | IORING_ENTER_EXT_ARG;
+        const auto result = syscall(__NR_io_uring_enter, this->descriptor, submit, wait, flags, &argument, sizeof(argument));
+        return result < 0x0 ? -errno : static_cast<int>(result);
+    }
+
+    UringBus::UringBus(const CANProfile& profile): bus_{profile}, socket_{-1}, rx_buffer_{}, tx_buffers_{}, rx_pending_{}, rx_error_{}, timeout_{} { }
+
+    bool UringBus::init(const std::string& interface) {
+        if (!this->bus_.init(interface)) { return false; }
+        this->socket_ = this->bus_.get_descriptor(); return this->init_rings();
+    }
+
+    bool UringBus::attach(const int descriptor) {
+        this->socket_ = descriptor; return this->init_rings();
+    }
+
+    bool UringBus::init_rings() {
+        if (!this->rx_.init(STD_RING_ENTRIES, iovec{&this->rx_buffer_, sizeof(this->rx_buffer_)})) { return false; }
+        if (!this->tx_.init(STD_RING_ENTRIES, iovec{this->tx_buffers_.data(), sizeof(this->tx_buffers_)})) { return false; }
+        this->arm_read();
+        if (this->rx_.enter(this->rx_pending_, 0x0, nullptr) < 0x0) { std::printf("[Robomaster]: failed to arm io_uring reads\n"); return false; }
+        this->rx_pending_ = 0x0; return true;
+    }
+
+    void UringBus::arm_read() {
+        io_uring_sqe sqe{}; sqe.opcode = IORING_OP_READ_FIXED; sqe.fd = this->socket_; sqe.buf_index = 0x0;
+        sqe.addr = reinterpret_cast<uint64_t>(&this->rx_buffer_); sqe.len = sizeof(can_frame);
+        this->rx_.push(sqe); this->rx_pending_++;
+    }
+
+    void UringBus::set_timeout(const double seconds) {
+        const auto limit = std::max(seconds, 0.0);
+        this->timeout_.tv_sec = static_cast<long long>(std::floor(limit)); this->timeout_.tv_nsec = static_cast<long long>((limit - std::floor(limit)) * 1e9);
+    }
+
+    bool UringBus::set_filter(const std::span<const uint32_t> device_ids) {
+        if (this->bus_.get_descriptor() >= 0x0) { return this->bus_.set_filter(device_ids); }
+        this->filter_.assign(device_ids.begin(), device_ids.end()); return true;
+    }
+
+    int UringBus::get_descriptor() {
+        return this->rx_.descriptor;
+    }
+
+    uint32_t UringBus::get_bitrate() {
+        return this->bus_.get_bitrate();
+    }
+
+    SendStatus UringBus::send_frames(const std::span<const can_frame> frames, size_t& sent) {
+        sent = 0x0;
+        for (size_t offset = 0; offset < frames.size();) {
+            const auto count = std::min(frames.size() - offset, STD_MAX_BATCH_SIZE);
+            for (size_t i = 0; i < count; i++) {
+                this->tx_buffers_[i] = frames[offset + i];
+                io_uring_sqe sqe{}; sqe.opcode = IORING_OP_WRITE_FIXED; sqe.fd = this->socket_; sqe.buf_index = 0x0; sqe.user_data = i;
+                sqe.addr = reinterpret_cast<uint64_t>(&this->tx_buffers_[i]); sqe.len = sizeof(can_frame); sqe.flags = i + 1 < count ? IOSQE_IO_LINK : 0x0;
+                this->tx_.push(sqe);
+            }
+            auto submit = static_cast<uint32_t>(count); bool success = true, busy = false;
+            for (size_t completed = 0; completed < count;) {
+                const auto result = this->tx_.enter(submit, static_cast<uint32_t>(count - completed), nullptr);
+                if (result < 0x0 && result != -EINTR) { std::printf("[Robomaster]: failed to submit can frames\n"); return SEND_STATUS_FAILED; }
+                if (result > 0x0) { submit -= static_cast<uint32_t>(result); }
+                io_uring_cqe cqe{};
+                while (this->tx_.pop(cqe)) {
+                    completed++; success &= cqe.res == sizeof(can_frame) || cqe.res == -ECANCELED; busy |= cqe.res == -ENOBUFS || cqe.res == -EAGAIN;
+                    if (cqe.res == sizeof(can_frame)) { sent++; }
+                }
+            }
+            if (busy) { return SEND_STATUS_BUSY; }
+            if (!success) { std::printf("[Robomaster]: failed to send can frames\n"); return SEND_STATUS_FAILED; }
+            offset += count;
+        } return SEND_STATUS_SENT;
+    }
+
+    bool UringBus::read_frames(const std::span<can_frame> frames, const std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) {
+        const auto length = std::min(frames.size(), timestamps.size()); count = 0x0;
+        if (this->rx_error_ != 0x0) { std::printf("[Robomaster]: failed to read can frames\n"); return false; }
+        while (count < length) {
+            // the re-armed read completes at submission while frames are queued, so the batch ends at the first empty poll
+            const auto result = this->rx_.enter(this->rx_pending_, count == 0x0 ? 1 : 0, &this->timeout_);
+            if (result >= 0x0) { this->rx_pending_ -= static_cast<uint32_t>(result); }
+            else if (result == -ETIME || result == -EINTR) { return true; }
+            else { std::printf("[Robomaster]: failed to read can frames\n"); return false; }
+
+            io_uring_cqe cqe{}; if (!this->rx_.pop(cqe)) { if (count != 0x0) { break; } continue; }
+            if (cqe.res < 0x0) { this->rx_error_ = cqe.res; if (count != 0x0) { break; } std::printf("[Robomaster]: failed to read can frames\n"); return false; }
+            auto frame = this->rx_buffer_; this->arm_read();
+            if (cqe.res != sizeof(can_frame)) { std::printf("[Robomaster]: dropped can frame of %d bytes\n", cqe.res); continue; }
+            frame.can_id = frame.can_id & CAN_EFF_FLAG ? frame.can_id & CAN_EFF_MASK: frame.can_id & CAN_SFF_MASK;
+            if (!this->filter_.empty() && std::ranges::find(this->filter_, frame.can_id) == this->filter_.end()) { continue; }
+            frames[count] = frame; timestamps[count] = std::chrono::system_clock::now(); count++;
+        } return true;
+    }
+} // namespace robomaster
@@ -22,8 +22,20 @@
  * SOFTWARE.
  */
 
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
 #include <iomanip>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
 #include "robomaster/utils.h"
 
 namespace robomaster {
@@ -81,16 +93,145 @@ namespace robomaster {
         0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
     };
 
-    uint8_t get_crc8(const uint8_t *data, const size_t length) {
-        uint8_t crc = 0x77;
-        for (size_t i = 0; i < length; i++) { crc = CRC8_CHECKSUM[crc ^ data[i]]; }
+    static constexpr uint8_t STD_CRC8_SEED = 0x77;
+    static constexpr size_t STD_SLICE_SIZE = 8;
+    static constexpr size_t STD_FOLD_SIZE = 16;
+
+    /**
+     * @brief The slicing-by-8 tables of a reflected crc, the table k contains the crc of a byte followed by k zero bytes.
+     */
+    template<typename T>
+    static constexpr auto make_slices(const T (&table)[256]) {
+        std::array<std::array<T, 256>, STD_SLICE_SIZE> slices{};
+        for (size_t i = 0; i < 256; i++) { slices[0][i] = table[i]; }
+        for (size_t k = 1; k < STD_SLICE_SIZE; k++) { for (size_t i = 0; i < 256; i++) { slices[k][i] = static_cast<T>(slices[k - 1][i] >> 8 ^ table[slices[k - 1][i] & 0xff]); } }
+        return slices;
+    }
+
+    constexpr auto CRC8_SLICES = make_slices(CRC8_CHECKSUM);
+    constexpr auto CRC16_SLICES = make_slices(CRC16_CHECKSUM);
+
+    template<typename T>
+    static T update_table(T crc, const T (&table)[256], const uint8_t* data, const size_t length) {
+        for (size_t i = 0; i < length; i++) { crc = static_cast<T>(crc >> 8 ^ table[(crc ^ data[i]) & 0xff]); }
         return crc;
     }
 
+    template<typename T>
+    static T update_slicing(T crc, const T (&table)[256], const std::array<std::array<T, 256>, STD_SLICE_SIZE>& slices, const uint8_t* data, size_t length) {
+        for (; length >= STD_SLICE_SIZE; data += STD_SLICE_SIZE, length -= STD_SLICE_SIZE) {
+            uint64_t word; std::memcpy(&word, data, STD_SLICE_SIZE); if constexpr (std::endian::native == std::endian::big) { word = std::byteswap(word); } word ^= crc;
+            crc = static_cast<T>(slices[7][word & 0xff] ^ slices[6][word >> 8 & 0xff] ^ slices[5][word >> 16 & 0xff] ^ slices[4][word >> 24 & 0xff] ^
+                                 slices[3][word >> 32 & 0xff] ^ slices[2][word >> 40 & 0xff] ^ slices[1][word >> 48 & 0xff] ^ slices[0][word >> 56]);
+        } return update_table(crc, table, data, length);
+    }
+
+    static uint16_t update_crc16_slicing(const uint16_t crc, const uint8_t* data, const size_t length) {
+        return update_slicing(crc, CRC16_CHECKSUM, CRC16_SLICES, data, length);
+    }
+
+    /**
+     * @brief x^n mod P of the crc16 polynomial x^16 + x^12 + x^5 + 1, bit reflected into a 64 bit lane for the carry-less multiplication.
+     */
+    static constexpr uint64_t fold_constant(const size_t n) {
+        uint32_t value = 0x1;
+        for (size_t i = 0; i < n; i++) { value <<= 1; if (value & 0x10000) { value ^= 0x11021; } }
+        uint64_t reflected = 0x0; for (size_t i = 0; i < 16; i++) { if (value >> i & 0x1) { reflected |= uint64_t{1} << (63 - i); } }
+        return reflected;
+    }
+
+    /**
+     * @brief Fold 16 bytes at a time into a 128 bit remainder with carry-less multiplication, the remainder is then reduced by the table.
+     * A block B0 followed by B1 is congruent to B1 + B0.hi * x^128 + B0.lo * x^192, the reflected constants are x^(n - 1) mod P,
+     * because the product of two reflected 64 bit lanes is shifted by one.
+     */
+    static constexpr uint64_t STD_FOLD_LOW = fold_constant(191);
+    static constexpr uint64_t STD_FOLD_HIGH = fold_constant(127);
+
+#if defined(__x86_64__) || defined(__i386__)
+    __attribute__((target("pclmul,sse2"))) static uint16_t update_crc16_clmul(const uint16_t crc, const uint8_t* data, size_t length) {
+        if (length < 2 * STD_FOLD_SIZE) { return update_crc16_slicing(crc, data, length); }
+        const auto constants = _mm_set_epi64x(static_cast<long long>(STD_FOLD_HIGH), static_cast<long long>(STD_FOLD_LOW));
+        auto remainder = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_cvtsi32_si128(crc));
+        for (data += STD_FOLD_SIZE, length -= STD_FOLD_SIZE; length >= STD_FOLD_SIZE; data += STD_FOLD_SIZE, length -= STD_FOLD_SIZE) {
+            const auto folded = _mm_xor_si128(_mm_clmulepi64_si128(remainder, constants, 0x00), _mm_clmulepi64_si128(remainder, constants, 0x11));
+            remainder = _mm_xor_si128(folded, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+        }
+        alignas(16) uint8_t block[STD_FOLD_SIZE]; _mm_store_si128(reinterpret_cast<__m128i*>(block), remainder);
+        return update_crc16_slicing(update_crc16_slicing(0x0, block, STD_FOLD_SIZE), data, length);
+    }
+
+    static bool has_clmul() {
+        return __builtin_cpu_supports("pclmul");
+    }
+#elif defined(__aarch64__)
+    __attribute__((target("+crypto"))) static uint16_t update_crc16_clmul(const uint16_t crc, const uint8_t* data, size_t length) {
+        if (length < 2 * STD_FOLD_SIZE) { return update_crc16_slicing(crc, data, length); }
+        const auto multiply = [](const uint64_t lane, const uint64_t constant) { return vreinterpretq_u64_p128(vmull_p64(lane, constant)); };
+        auto remainder = veorq_u64(vreinterpretq_u64_u8(vld1q_u8(data)), vcombine_u64(vcreate_u64(crc), vcreate_u64(0x0)));
+        for (data += STD_FOLD_SIZE, length -= STD_FOLD_SIZE; length >= STD_FOLD_SIZE; data += STD_FOLD_SIZE, length -= STD_FOLD_SIZE) {
+            const auto folded = veorq_u64(multiply(vgetq_lane_u64(remainder, 0), STD_FOLD_LOW), multiply(vgetq_lane_u64(remainder, 1), STD_FOLD_HIGH));
+            remainder = veorq_u64(folded, vreinterpretq_u64_u8(vld1q_u8(data)));
+        }
+        uint8_t block[STD_FOLD_SIZE]; vst1q_u8(block, vreinterpretq_u8_u64(remainder));
+        return update_crc16_slicing(update_crc16_slicing(0x0, block, STD_FOLD_SIZE), data, length);
+    }
+
+    static bool has_clmul() {
+        return getauxval(AT_HWCAP) & HWCAP_PMULL;
+    }
+#else
+    static uint16_t update_crc16_clmul(const uint16_t crc, const uint8_t* data, const size_t length) {
+        return update_crc16_slicing(crc, data, length);
+    }
+
+    static bool has_clmul() {
+        return false;
+    }
+#endif
+
+    using CRC16Function = uint16_t (*)(uint16_t crc, const uint8_t* data, size_t length);
+
+    static uint16_t resolve_crc16(uint16_t crc, const uint8_t* data, size_t length);
+
+    /**
+     * @brief The selected crc16 kernel, resolved on the first call so that it is valid during static initialization.
+     */
+    constinit static std::atomic<CRC16Function> crc16_function{resolve_crc16};
+
+    static uint16_t resolve_crc16(const uint16_t crc, const uint8_t* data, const size_t length) {
+        const CRC16Function function = get_crc_kernel() == CRC_KERNEL_CLMUL ? update_crc16_clmul : update_crc16_slicing;
+        crc16_function.store(function, std::memory_order::relaxed); return function(crc, data, length);
+    }
+
+    uint8_t get_crc8(const uint8_t *data, const size_t length) {
+        return length < STD_SLICE_SIZE ? update_table(STD_CRC8_SEED, CRC8_CHECKSUM, data, length) : update_slicing(STD_CRC8_SEED, CRC8_CHECKSUM, CRC8_SLICES, data, length);
+    }
+
     uint16_t get_crc16(const uint8_t *data, const size_t length) {
-        uint16_t crc = 0x3692;
-        for (size_t i = 0; i < length; i++) { crc = crc >> 8 & 0xff ^ CRC16_CHECKSUM[(crc ^ data[i]) & 0xff]; }
-        return crc;
+        return update_crc16(STD_CRC16_SEED, data, length);
+    }
+
+    uint16_t update_crc16(const uint16_t crc, const uint8_t* data, const size_t length) {
+        return crc16_function.load(std::memory_order::relaxed)(crc, data, length);
+    }
+
+    uint8_t get_crc8(const uint8_t* data, const size_t length, const CRCKernel kernel) {
+        return kernel == CRC_KERNEL_TABLE ? update_table(STD_CRC8_SEED, CRC8_CHECKSUM, data, length) : update_slicing(STD_CRC8_SEED, CRC8_CHECKSUM, CRC8_SLICES, data, length);
+    }
+
+    uint16_t get_crc16(const uint8_t* data, const size_t length, const CRCKernel kernel) {
+        if (kernel == CRC_KERNEL_CLMUL) { return update_crc16_clmul(STD_CRC16_SEED, data, length); }
+        return kernel == CRC_KERNEL_SLICING ? update_crc16_slicing(STD_CRC16_SEED, data, length) : update_table(STD_CRC16_SEED, CRC16_CHECKSUM, data, length);
+    }
+
+    bool is_supported(const CRCKernel kernel) {
+        return kernel != CRC_KERNEL_CLMUL || has_clmul();
+    }
+
+    CRCKernel get_crc_kernel() {
+        static const auto kernel = is_supported(CRC_KERNEL_CLMUL) ? CRC_KERNEL_CLMUL : CRC_KERNEL_SLICING;
+        return kernel;
     }
 
     uint16_t get_little_endian(const uint8_t ls_byte, const uint8_t ms_byte) {
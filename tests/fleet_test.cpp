@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <thread>
+
+#include "robomaster/fleet.h"
+#include "robomaster/loopback.h"
+#include "gtest/gtest.h"
+#include "helpers.h"
+
+namespace robomaster {
+    static void send_gimbal(Transport& transport, const int16_t pitch) {
+        auto msg = Message(0x203, 0x0904, 1, std::vector<uint8_t>{ 0x00, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 });
+        msg.set_int16(5, pitch); ASSERT_EQ(transport.send_frames(encode(msg)), SEND_STATUS_SENT);
+    }
+
+    TEST(FleetTest, Init) {
+        RoboMasterFleet fleet;
+        auto [local, remote] = LoopbackBus::create_pair();
+        ASSERT_FALSE(fleet.add(std::move(local), "loopback"));
+        ASSERT_TRUE(fleet.init(2));
+        ASSERT_FALSE(fleet.init(2));
+        ASSERT_EQ(fleet.size(), 0);
+    }
+
+    TEST(FleetTest, IndependentState) {
+        RoboMasterFleet fleet; std::vector<std::unique_ptr<LoopbackBus>> remotes;
+        ASSERT_TRUE(fleet.init(2));
+        for (size_t i = 0; i < 3; i++) {
+            auto [local, remote] = LoopbackBus::create_pair(); remotes.push_back(std::move(remote));
+            ASSERT_TRUE(fleet.add(std::move(local), "loopback"));
+        }
+        ASSERT_EQ(fleet.size(), 3);
+        ASSERT_TRUE(fleet.is_running());
+
+        for (size_t i = 0; i < remotes.size(); i++) { send_gimbal(*remotes[i], static_cast<int16_t>(100 * (i + 1))); }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (std::chrono::steady_clock::now() < deadline && !(fleet[0].get_state().is_active && fleet[1].get_state().is_active && fleet[2].get_state().is_active)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        for (size_t i = 0; i < remotes.size(); i++) {
+            ASSERT_TRUE(fleet[i].get_state().is_active);
+            ASSERT_EQ(fleet[i].get_state().gimbal.pitch, 100 * (i + 1));
+        }
+    }
+
+    TEST(FleetTest, HandlerConfig) {
+        RoboMasterFleet fleet; HandlerConfig config{}; config.mode = HANDLER_MODE_THREADED; config.kernel_heartbeat = true; config.queue_capacity.fill(1);
+        auto [local, remote] = LoopbackBus::create_pair();
+        ASSERT_TRUE(fleet.init(1));
+        ASSERT_TRUE(fleet.add(std::move(local), "loopback", config));
+        ASSERT_TRUE(fleet[0].is_running());
+
+        send_gimbal(*remote, 100);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (std::chrono::steady_clock::now() < deadline && !fleet[0].get_state().is_active) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+        ASSERT_TRUE(fleet[0].get_state().is_active);
+        ASSERT_EQ(fleet[0].get_state().gimbal.pitch, 100);
+    }
+} // namespace robomaster
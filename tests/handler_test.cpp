@@ -0,0 +1,538 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include "robomaster/handler.h"
+#include "robomaster/loopback.h"
+#include "robomaster/replay.h"
+#include "robomaster/utils.h"
+#include "gtest/gtest.h"
+#include "helpers.h"
+
+namespace robomaster {
+    static std::vector<uint8_t> receive(Transport& transport, const uint32_t device_id, const size_t length) {
+        std::vector<uint8_t> data; std::array<can_frame, 16> frames{}; std::array<std::chrono::system_clock::time_point, 16> timestamps{}; size_t count = 0;
+        while (data.size() < length && transport.read_frames(frames, timestamps, count) && count != 0) {
+            for (size_t i = 0; i < count; i++) { if (frames[i].can_id == device_id) { data.insert(data.end(), frames[i].data, frames[i].data + frames[i].can_dlc); } }
+        } return data;
+    }
+
+    class ProxyBus final : public Transport {
+        std::unique_ptr<Transport> transport_;
+    public:
+        std::vector<can_frame> frames; size_t message_frames = 0; std::chrono::microseconds period{}; std::atomic<bool> is_cyclic{false};
+        std::atomic<SendStatus> status{SEND_STATUS_SENT};
+        std::atomic<size_t> limit{std::numeric_limits<size_t>::max()}; std::atomic<uint32_t> blocked{0};
+        std::chrono::steady_clock::time_point origin; std::atomic<std::chrono::steady_clock::duration> phase{}; std::function<void()> on_stop;
+        explicit ProxyBus(std::unique_ptr<Transport> transport): transport_{std::move(transport)} { }
+        bool init(const std::string& interface) override { return this->transport_->init(interface); }
+        void set_timeout(const double seconds) override { this->transport_->set_timeout(seconds); }
+        bool set_filter(const std::span<const uint32_t> device_ids) override { return this->transport_->set_filter(device_ids); }
+        int get_descriptor() override { return this->transport_->get_descriptor(); }
+        using Transport::send_frames;
+        SendStatus send_frames(const std::span<const can_frame> frames_, size_t& sent) override {
+            sent = 0; if (this->status != SEND_STATUS_SENT) { return this->status; }
+            if (this->is_cyclic) { this->phase = (std::chrono::steady_clock::now() - this->origin) % std::chrono::steady_clock::duration(this->period); }
+            const auto unblocked = static_cast<size_t>(std::ranges::find(frames_, this->blocked.load(), &can_frame::can_id) - frames_.begin());
+            const auto count = std::min(unblocked, this->limit.load()); const auto result = this->transport_->send_frames(frames_.first(count), sent);
+            return result == SEND_STATUS_SENT && count < frames_.size() ? SEND_STATUS_BUSY : result;
+        }
+        bool read_frames(const std::span<can_frame> frames_, const std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) override { return this->transport_->read_frames(frames_, timestamps, count); }
+        bool start_cyclic(const std::span<const can_frame> frames_, const size_t message_frames_, const std::chrono::microseconds period_) override {
+            this->frames.assign(frames_.begin(), frames_.end()); this->message_frames = message_frames_; this->period = period_; this->is_cyclic = true;
+            this->origin = std::chrono::steady_clock::now(); return true;
+        }
+        void stop_cyclic() override { this->is_cyclic = false; if (this->on_stop) { this->on_stop(); } }
+    };
+
+    /**
+     * @brief Sends the cyclic frames like the broadcast manager of the kernel, which re-arms the timer of the next frame relative
+     * to the current time, so the latency of every timer adds up. The latency is a constant delay per frame and the frames are echoed
+     * to the reading end like on a can bus.
+     */
+    class DriftingBus final : public Transport {
+        std::unique_ptr<Transport> transport_; Transport& echo_; std::chrono::microseconds drift_; std::mutex mutex_; std::thread thread_; std::atomic<bool> is_running_{false};
+    public:
+        DriftingBus(std::unique_ptr<Transport> transport, Transport& echo, const std::chrono::microseconds drift): transport_{std::move(transport)}, echo_{echo}, drift_{drift} { }
+        ~DriftingBus() override { this->stop_cyclic(); }
+        bool init(const std::string& interface) override { return this->transport_->init(interface); }
+        void set_timeout(const double seconds) override { this->transport_->set_timeout(seconds); }
+        bool set_filter(const std::span<const uint32_t> device_ids) override { return this->transport_->set_filter(device_ids); }
+        int get_descriptor() override { return this->transport_->get_descriptor(); }
+        using Transport::send_frames;
+        SendStatus send_frames(const std::span<const can_frame> frames, size_t& sent) override { std::lock_guard lock{this->mutex_}; return this->transport_->send_frames(frames, sent); }
+        bool read_frames(const std::span<can_frame> frames, const std::span<std::chrono::system_clock::time_point> timestamps, size_t& count) override { return this->transport_->read_frames(frames, timestamps, count); }
+        bool start_cyclic(const std::span<const can_frame> frames_, const size_t message_frames, const std::chrono::microseconds period) override {
+            this->is_running_ = true;
+            this->thread_ = std::thread{[this, frames = std::vector(frames_.begin(), frames_.end()), interval = period / message_frames] {
+                auto next = std::chrono::steady_clock::now();
+                for (size_t i = 0; this->is_running_; i = (i + 1) % frames.size()) {
+                    std::this_thread::sleep_until(next); { std::lock_guard lock{this->mutex_}; this->transport_->send_frames(std::span{frames}.subspan(i, 1)); }
+                    // a late wakeup moves the schedule like the echo does, catching up would send ahead of the echoed time
+                    this->echo_.send_frames(std::span{frames}.subspan(i, 1)); next = std::max(next, std::chrono::steady_clock::now()) + interval + this->drift_;
+                }
+            }}; return true;
+        }
+        void stop_cyclic() override { this->is_running_ = false; if (this->thread_.joinable()) { this->thread_.join(); } }
+    };
+
+    TEST(HandlerTest, Heartbeat) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        Handler handler{std::move(local)};
+        ASSERT_TRUE(handler.init("loopback"));
+        ASSERT_TRUE(handler.is_running());
+
+        const auto data = receive(*remote, 0x201, 27);
+        ASSERT_GE(data.size(), 27);
+        ASSERT_EQ(data[0], 0x55);
+        ASSERT_EQ(data[1], 27);
+        ASSERT_EQ(get_crc16(data.data(), 25), get_little_endian(data[25], data[26]));
+    }
+
+    TEST(HandlerTest, PushMessage) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        Handler handler{std::move(local)};
+        ASSERT_TRUE(handler.init("loopback"));
+
+        handler.push_message(Message(0x202, 0xc3c9, 7, std::vector<uint8_t>(40, 0xab)));
+        const auto data = receive(*remote, 0x202, 50);
+        ASSERT_EQ(data.size(), 50);
+        const auto msg = Message(0x202, data);
+        ASSERT_TRUE(msg.is_valid());
+        ASSERT_EQ(msg.get_sequence(), 7);
+        ASSERT_TRUE(std::ranges::equal(msg.get_payload(), std::vector<uint8_t>(40, 0xab)));
+    }
+
+    TEST(HandlerTest, ReceiveMessage) {
+        auto [local, remote] = LoopbackBus::create_pair();
+        Handler handler{std::move(local)}; std::promise<Message> promise;
+        handler.set_callback([&promise](const Message& msg) { promise.set_value(msg); });
+        ASSERT_TRUE(handler.init("loopback"));
+
+        auto msg = Message(0x203, 0x0904, 1, std::vector<uint8_t>{ 0x00, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 });
+        msg.set_int16(5, 1000);
+        msg.set_int16(7, -1000);
+        ASSERT_EQ(remote->send_frames(encode(Message(0x204, 0x0904, 0, std::vector<uint8_t>(20, 0x55)))), SEND_STATUS_SENT);
+        ASSERT_EQ(remote->send_frames(encode(msg)), SEND_STATUS_SENT);
+
+        auto future = promise.get_future();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+        const auto received = future.get();
+        ASSERT_EQ(received.get_device_id(), 0x203);
+        ASSERT_EQ(received.get_int16(5), 1000);
+        ASSERT_EQ(received.get_int16(7), -1000);
+        ASSERT_NE(received.get_first_timestamp(), std::chrono::system_clock::time_point{});
+        ASSERT_LE(received.get_first_timestamp(), received.get_last_timestamp());
+    }
+
+    TEST(HandlerTest, Pipeline) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair();
+            Handler handler{std::move(local)}; std::promise<std::string> promise; std::atomic<size_t> count{0};
+            handler.set_callback([&promise, &count](const Message& msg) {
+                if (msg.get_device_id() == 0x203 && count++ == 0) { std::array<char, 16> name{}; pthread_getname_np(pthread_self(), name.data(), name.size()); promise.set_value(name.data()); }
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            });
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{.mode = mode, .pipeline = true}));
+
+            for (uint16_t i = 0; i < 5; i++) { ASSERT_EQ(remote->send_frames(encode(Message(0x203, 0x0904, i, std::vector<uint8_t>{ 0x00, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }))), SEND_STATUS_SENT); }
+            auto future = promise.get_future();
+            ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            while (count < 5 && std::chrono::steady_clock::now() < deadline) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+            ASSERT_EQ(count, 5);
+
+            ASSERT_EQ(future.get(), "robomaster-dec");
+            const auto stats = handler.stats();
+            ASSERT_EQ(stats.devices[Registry::index(0x203)].messages, 5);
+            ASSERT_EQ(stats.pipeline.capacity, STD_PIPELINE_CAPACITY);
+            ASSERT_GE(stats.pipeline.max_depth, 1);
+            ASSERT_EQ(stats.pipeline.messages_dropped, 0);
+        }
+    }
+
+    TEST(HandlerTest, Subscribe) {
+        for (const auto pipeline : {false, true}) {
+            auto [local, remote] = LoopbackBus::create_pair();
+            Handler handler{std::move(local)}; std::atomic<size_t> frames{0}, messages{0}, gimbal{0};
+            const auto frame_subscription = handler.subscribe_frames([&frames](const can_frame& frame, auto) { if (frame.can_id == 0x203) { frames++; } }, 0x203);
+            handler.subscribe([&messages](const Message&) { messages++; });
+            const auto gimbal_subscription = handler.subscribe([&gimbal](const Message& msg) { ASSERT_EQ(msg.get_type(), 0x0904); gimbal++; }, 0x203, 0x0904);
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{.pipeline = pipeline}));
+
+            const auto gimbal_message = encode(Message(0x203, 0x0904, 0, std::vector<uint8_t>{ 0x00, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }));
+            ASSERT_EQ(remote->send_frames(gimbal_message), SEND_STATUS_SENT);
+            ASSERT_EQ(remote->send_frames(encode(Message(0x203, 0x0903, 0, std::vector<uint8_t>(4, 0x00)))), SEND_STATUS_SENT);
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            while (messages < 2 && std::chrono::steady_clock::now() < deadline) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+            ASSERT_EQ(messages, 2);
+            ASSERT_EQ(gimbal, 1);
+            ASSERT_EQ(frames, gimbal_message.size() + 2);
+
+            ASSERT_TRUE(handler.unsubscribe(gimbal_subscription));
+            ASSERT_TRUE(handler.unsubscribe_frames(frame_subscription));
+            ASSERT_FALSE(handler.unsubscribe_frames(frame_subscription));
+            ASSERT_EQ(remote->send_frames(gimbal_message), SEND_STATUS_SENT);
+            while (messages < 3 && std::chrono::steady_clock::now() < deadline) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+            ASSERT_EQ(messages, 3);
+            ASSERT_EQ(gimbal, 1);
+            ASSERT_EQ(frames, gimbal_message.size() + 2);
+        }
+    }
+
+    TEST(HandlerTest, Command) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair();
+            auto handler = std::make_unique<Handler>(std::move(local));
+            ASSERT_TRUE(handler->init("loopback", HandlerConfig{.mode = mode}));
+
+            auto acknowledged = handler->push_command(Message(0x201, 0xc3c9, 7, std::vector<uint8_t>{ 0x40, 0x3f, 0x19, 0x01 }), COMMAND_CLASS_SAFETY);
+            auto expired = handler->push_command(Message(0x201, 0x04c9, 8, std::vector<uint8_t>{ 0x40, 0x04, 0x4c, 0x00 }), COMMAND_CLASS_SAFETY, std::chrono::milliseconds(30));
+            ASSERT_EQ(remote->send_frames(encode(Message(0x202, 0xc9c3, 6, std::vector<uint8_t>{ 0x80, 0x3f, 0x19, 0x00 }))), SEND_STATUS_SENT);
+            ASSERT_EQ(remote->send_frames(encode(Message(0x202, 0xc9c3, 7, std::vector<uint8_t>{ 0x80, 0x3f, 0x19, 0x00 }))), SEND_STATUS_SENT);
+
+            ASSERT_EQ(acknowledged.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+            const auto result = acknowledged.get();
+            ASSERT_EQ(result.status, COMMAND_STATUS_ACKNOWLEDGED);
+            ASSERT_GT(result.round_trip.count(), 0);
+            ASSERT_EQ(result.reply.get_sequence(), 7);
+            ASSERT_EQ(expired.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+            ASSERT_EQ(expired.get().status, COMMAND_STATUS_TIMEOUT);
+
+            const auto stats = handler->stats();
+            ASSERT_EQ(stats.command_round_trips.count, 1);
+            ASSERT_EQ(stats.command_round_trips.max, result.round_trip);
+            ASSERT_EQ(stats.command_timeouts, 1);
+            ASSERT_EQ(stats.messages_unmatched, 1);
+
+            std::vector<std::future<CommandResult>> pending;
+            for (uint16_t i = 0; i < STD_MAX_PENDING_COMMANDS; i++) { pending.push_back(handler->push_command(Message(0x201, 0xc3c9, 100 + i, std::vector<uint8_t>{ 0x40, 0x3f, 0x19, 0x01 }), COMMAND_CLASS_SAFETY)); }
+            auto overflow = handler->push_command(Message(0x201, 0xc3c9, 200, std::vector<uint8_t>{ 0x40, 0x3f, 0x19, 0x01 }), COMMAND_CLASS_SAFETY);
+            ASSERT_EQ(overflow.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+            ASSERT_EQ(overflow.get().status, COMMAND_STATUS_OVERFLOW);
+            handler.reset();
+            for (auto& future : pending) { ASSERT_EQ(future.get().status, COMMAND_STATUS_STOPPED); }
+        }
+    }
+
+    TEST(HandlerTest, Pacing) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+            Handler handler{std::move(local)};
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{.mode = mode, .bitrate = 100000, .command_share = 0.5}));
+
+            const auto start = std::chrono::steady_clock::now();
+            for (uint16_t i = 0; i < 10; i++) { handler.push_message(Message(0x202, 0xc3c9, i, std::vector<uint8_t>(20, 0xab))); }
+            ASSERT_EQ(receive(*remote, 0x202, 300).size(), 300);
+            ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(70));
+        }
+    }
+
+    TEST(HandlerTest, HeartbeatPeriods) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+            Handler handler{std::move(local)};
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{.mode = mode}));
+            for (uint16_t i = 0; i < 20; i++) { handler.push_message(Message(0x202, 0xc3c9, i, std::vector<uint8_t>(20, 0xab))); }
+            ASSERT_GE(receive(*remote, 0x201, 11 * 27).size(), 11 * 27);
+
+            const auto periods = handler.stats().heartbeat_periods;
+            ASSERT_GE(periods.count, 10);
+            ASSERT_GT(periods.percentile(0.5), std::chrono::milliseconds(9));
+            ASSERT_LE(periods.percentile(0.5), std::chrono::milliseconds(11));
+            ASSERT_LE(periods.min, periods.mean);
+            ASSERT_GE(periods.max, periods.mean);
+            ASSERT_LE(periods.percentile(0.5), periods.percentile(0.99));
+        }
+    }
+
+    TEST(HandlerTest, ThreadConfig) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair();
+            Handler handler{std::move(local)}; HandlerConfig config{.mode = mode}; config.sender.cpus = {CPU_SETSIZE};
+            ASSERT_FALSE(handler.init("loopback", config));
+            ASSERT_FALSE(handler.is_running());
+            config.sender.cpus = {};
+            ASSERT_TRUE(handler.init("loopback", config));
+            ASSERT_TRUE(handler.is_running());
+        }
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        Handler handler{std::move(local)}; HandlerConfig config; config.receiver.cpus = {0}; config.sender.cpus = {0};
+        ASSERT_TRUE(handler.init("loopback", config));
+        ASSERT_GE(receive(*remote, 0x201, 27).size(), 27);
+    }
+
+    TEST(HandlerTest, Stats) {
+        auto [local, remote] = LoopbackBus::create_pair();
+        Handler handler{std::move(local)};
+        ASSERT_TRUE(handler.init("loopback"));
+
+        const auto gimbal = [](const uint16_t sequence) { return encode(Message(0x203, 0x0904, sequence, std::vector<uint8_t>{ 0x00, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 })); };
+        auto corrupted = gimbal(0); corrupted[1].data[3] ^= 0xff;
+        can_frame garbage{}; garbage.can_id = 0x203; garbage.can_dlc = 3; garbage.data[0] = 0x01; garbage.data[1] = 0x02; garbage.data[2] = 0x03;
+        ASSERT_EQ(remote->send_frames(encode(Message(0x204, 0x0904, 0, std::vector<uint8_t>(20, 0x00)))), SEND_STATUS_SENT);
+        ASSERT_EQ(remote->send_frames(std::span{&garbage, 1}), SEND_STATUS_SENT);
+        ASSERT_EQ(remote->send_frames(corrupted), SEND_STATUS_SENT);
+        ASSERT_EQ(remote->send_frames(encode(Message(0x203, 0x0903, 0, std::vector<uint8_t>(4, 0x00)))), SEND_STATUS_SENT);
+        for (const uint16_t sequence : {1, 2, 4}) { ASSERT_EQ(remote->send_frames(gimbal(sequence)), SEND_STATUS_SENT); std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (handler.stats().devices[Registry::index(0x203)].messages < 3 && std::chrono::steady_clock::now() < deadline) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+        const auto stats = handler.stats(); const auto& device = stats.devices[Registry::index(0x203)];
+        ASSERT_EQ(device.device_id, 0x203);
+        ASSERT_EQ(device.messages, 3);
+        ASSERT_EQ(device.sequence_gaps, 1);
+        ASSERT_GT(device.interval.count(), 0);
+        ASSERT_GT(device.rate, 0.0);
+        ASSERT_EQ(stats.frames_unknown, 0);
+        ASSERT_EQ(stats.messages_unmatched, 1);
+        ASSERT_EQ(stats.parser.checksum_failures, 1);
+        ASSERT_EQ(stats.parser.bytes_discarded, 3 + 19);
+        ASSERT_GE(stats.frames_received, 1 + 3 + 2 + 3 * 3);
+        ASSERT_EQ(stats.send_failures, 0);
+    }
+
+    TEST(HandlerTest, Idle) {
+        auto [local, remote] = LoopbackBus::create_pair();
+        Handler handler{std::move(local)};
+        ASSERT_TRUE(handler.init("loopback"));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(800));
+        ASSERT_TRUE(handler.is_running());
+        ASSERT_GT(handler.stats().read_timeouts, 0);
+        ASSERT_EQ(handler.stats().read_failures, 0);
+    }
+
+    TEST(HandlerTest, ReplayEnd) {
+        const auto path = testing::TempDir() + "robomaster_handler_replay.log"; std::ofstream{path} << "(1700000000.250000) can0 202#55AB04\n";
+        auto bus = std::make_unique<ReplayBus>(); auto& replay = *bus;
+        Handler handler{std::move(bus)};
+        ASSERT_TRUE(handler.init(path));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(800));
+        ASSERT_TRUE(replay.is_finished());
+        ASSERT_TRUE(handler.is_running());
+        ASSERT_EQ(handler.stats().read_failures, 0);
+        std::remove(path.c_str());
+    }
+
+    TEST(HandlerTest, ReactorMode) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        auto handler = std::make_unique<Handler>(std::move(local)); std::promise<Message> promise;
+        handler->set_callback([&promise](const Message& msg) { promise.set_value(msg); });
+        ASSERT_TRUE(handler->init("loopback", HandlerConfig{HANDLER_MODE_REACTOR}));
+        ASSERT_TRUE(handler->is_running());
+
+        const auto heartbeat = receive(*remote, 0x201, 27);
+        ASSERT_GE(heartbeat.size(), 27);
+        ASSERT_EQ(heartbeat[1], 27);
+
+        handler->push_message(Message(0x202, 0xc3c9, 7, std::vector<uint8_t>(40, 0xab)));
+        const auto data = receive(*remote, 0x202, 50);
+        ASSERT_EQ(data.size(), 50);
+        ASSERT_TRUE(Message(0x202, data).is_valid());
+
+        auto msg = Message(0x203, 0x0904, 1, std::vector<uint8_t>{ 0x00, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 });
+        msg.set_int16(5, 1000);
+        ASSERT_EQ(remote->send_frames(encode(msg)), SEND_STATUS_SENT);
+        auto future = promise.get_future();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+        ASSERT_EQ(future.get().get_int16(5), 1000);
+
+        const auto start = std::chrono::steady_clock::now(); handler.reset();
+        ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+    }
+
+    TEST(HandlerTest, ReactorModeFiltered) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.05);
+        Handler handler{std::move(local)};
+        ASSERT_TRUE(handler.init("loopback", HandlerConfig{HANDLER_MODE_REACTOR}));
+
+        // frames of unknown devices are filtered by the transport and must not block the reactor thread
+        std::array<can_frame, 16> frames{}; std::array<std::chrono::system_clock::time_point, 16> timestamps{}; size_t count = 0;
+        std::vector<std::chrono::steady_clock::time_point> heartbeats; const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+        while (std::chrono::steady_clock::now() < deadline && remote->read_frames(frames, timestamps, count)) {
+            can_frame unknown{}; unknown.can_id = 0x300; unknown.can_dlc = 8; ASSERT_EQ(remote->send_frames(std::span{&unknown, 1}), SEND_STATUS_SENT);
+            for (size_t i = 0; i < count; i++) { if (frames[i].can_id == 0x201 && frames[i].can_dlc == 3) { heartbeats.push_back(std::chrono::steady_clock::now()); } }
+        }
+        ASSERT_GT(heartbeats.size(), 10);
+        for (size_t i = 1; i < heartbeats.size(); i++) { ASSERT_LT(heartbeats[i] - heartbeats[i - 1], std::chrono::milliseconds(50)); }
+    }
+
+    TEST(HandlerTest, ReactorModeWithoutDescriptor) {
+        Handler handler{std::make_unique<ReplayBus>()};
+        ASSERT_FALSE(handler.init("/dev/null", HandlerConfig{HANDLER_MODE_REACTOR}));
+    }
+
+    TEST(HandlerTest, KernelHeartbeat) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.05);
+        auto bus = std::make_unique<ProxyBus>(std::move(local)); auto& cyclic = *bus;
+        std::atomic<bool> is_stopped{false}; cyclic.on_stop = [&is_stopped] { is_stopped = true; };
+        auto handler = std::make_unique<Handler>(std::move(bus));
+        ASSERT_TRUE(handler->init("loopback", HandlerConfig{.kernel_heartbeat = true}));
+        ASSERT_TRUE(cyclic.is_cyclic);
+        ASSERT_EQ(cyclic.period, std::chrono::milliseconds(10));
+        ASSERT_EQ(cyclic.message_frames, 4);
+        ASSERT_EQ(cyclic.frames.size(), 64 * 4);
+
+        for (size_t counter = 0; counter < 64; counter++) {
+            std::vector<uint8_t> data;
+            for (size_t i = 0; i < 4; i++) { const auto& frame = cyclic.frames[counter * 4 + i]; ASSERT_EQ(frame.can_id, 0x201); data.insert(data.end(), frame.data, frame.data + frame.can_dlc); }
+            const auto msg = Message(0x201, data);
+            ASSERT_TRUE(msg.is_valid());
+            ASSERT_EQ(msg.get_sequence(), counter);
+        }
+        ASSERT_TRUE(receive(*remote, 0x201, 27).empty());
+        handler.reset();
+        ASSERT_TRUE(is_stopped);
+    }
+
+    TEST(HandlerTest, KernelHeartbeatWindow) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        auto bus = std::make_unique<ProxyBus>(std::move(local)); auto& cyclic = *bus;
+        Handler handler{std::move(bus)};
+        ASSERT_TRUE(handler.init("loopback", HandlerConfig{.kernel_heartbeat = true}));
+        ASSERT_TRUE(cyclic.is_cyclic);
+
+        // the last of the four frames is sent 7.5 ms into the period
+        const auto msg = Message(0x201, 0xc3c9, 7, std::vector<uint8_t>(20, 0xab)); handler.push_message(msg);
+        ASSERT_EQ(receive(*remote, 0x201, msg.vector().size()), msg.vector());
+        ASSERT_GE(cyclic.phase.load(), std::chrono::microseconds(7500));
+    }
+
+    TEST(HandlerTest, KernelHeartbeatDrift) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.005);
+            // 160 us of drift per period, the schedule of the start time is off by a whole period after about 60 periods
+            Handler handler{std::make_unique<DriftingBus>(std::move(local), *remote, std::chrono::microseconds(40))};
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{.mode = mode, .kernel_heartbeat = true}));
+
+            StreamParser parser; size_t heartbeats = 0, commands = 0; uint16_t sequence = 0; std::array<can_frame, 16> frames{}; std::array<std::chrono::system_clock::time_point, 16> timestamps{}; size_t count = 0;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            while (std::chrono::steady_clock::now() < deadline && remote->read_frames(frames, timestamps, count)) {
+                handler.push_message(Message(0x201, 0xc3c9, sequence++, std::vector<uint8_t>(20, 0xab)));
+                for (size_t i = 0; i < count; i++) {
+                    if (frames[i].can_id != 0x201) { continue; }
+                    parser.push(std::span{frames[i].data, frames[i].can_dlc}, timestamps[i], [&heartbeats, &commands](const std::span<const uint8_t> data, auto, auto) { data.size() == 27 ? heartbeats++ : commands++; });
+                }
+            }
+            ASSERT_EQ(parser.stats().header_failures, 0);
+            ASSERT_EQ(parser.stats().checksum_failures, 0);
+            ASSERT_GT(heartbeats, 50);
+            ASSERT_GT(commands, 50);
+        }
+    }
+
+    TEST(HandlerTest, KernelHeartbeatFallback) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        Handler handler{std::move(local)};
+        ASSERT_TRUE(handler.init("loopback", HandlerConfig{.kernel_heartbeat = true}));
+        ASSERT_GE(receive(*remote, 0x201, 27).size(), 27);
+    }
+
+    TEST(HandlerTest, Backpressure) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.5);
+        auto bus = std::make_unique<ProxyBus>(std::move(local)); auto& proxy = *bus;
+        Handler handler{std::move(bus)}; proxy.status = SEND_STATUS_BUSY;
+        ASSERT_TRUE(handler.init("loopback"));
+
+        for (size_t i = 0; i < 20; i++) { handler.push_message(Message(0x202, 0xc3c9, 7, std::vector<uint8_t>(40, 0xab))); }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        ASSERT_TRUE(handler.is_running());
+
+        proxy.status = SEND_STATUS_SENT;
+        ASSERT_GE(receive(*remote, 0x201, 27).size(), 27);
+        ASSERT_TRUE(handler.is_running());
+    }
+
+    TEST(HandlerTest, PartialSend) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.1);
+            auto bus = std::make_unique<ProxyBus>(std::move(local)); bus->limit = 3;
+            Handler handler{std::move(bus)};
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{mode}));
+
+            for (uint16_t i = 0; i < 5; i++) { handler.push_message(Message(0x201, 0xc3c9, 100 + i, std::vector<uint8_t>(40, 0xab)), COMMAND_CLASS_SAFETY); }
+            StreamParser parser; std::vector<uint16_t> sequences; std::array<can_frame, 16> frames{}; std::array<std::chrono::system_clock::time_point, 16> timestamps{}; size_t count = 0;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            while (sequences.size() < 5 && std::chrono::steady_clock::now() < deadline && remote->read_frames(frames, timestamps, count)) {
+                for (size_t i = 0; i < count; i++) {
+                    parser.push(std::span{frames[i].data, frames[i].can_dlc}, timestamps[i], [&sequences](const std::span<const uint8_t> data, auto, auto) {
+                        if (const auto msg = Message(0x201, data); msg.get_payload().size() == 40) { sequences.push_back(msg.get_sequence()); }
+                    });
+                }
+            }
+            ASSERT_EQ(sequences, (std::vector<uint16_t>{100, 101, 102, 103, 104}));
+            ASSERT_EQ(parser.stats().header_failures, 0);
+            ASSERT_EQ(parser.stats().checksum_failures, 0);
+            ASSERT_GT(handler.stats().send_busy, 0);
+            ASSERT_TRUE(handler.is_running());
+        }
+    }
+
+    TEST(HandlerTest, Superseded) {
+        for (const auto mode : {HANDLER_MODE_THREADED, HANDLER_MODE_REACTOR}) {
+            auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.1);
+            auto bus = std::make_unique<ProxyBus>(std::move(local)); auto& proxy = *bus; proxy.blocked = 0x202;
+            Handler handler{std::move(bus)};
+            ASSERT_TRUE(handler.init("loopback", HandlerConfig{mode}));
+
+            handler.push_message(Message(0x202, 0xc3c9, 100, std::vector<uint8_t>(10, 0xab)), COMMAND_CLASS_GIMBAL_VELOCITY);
+            handler.push_message(Message(0x202, 0xc3c9, 200, std::vector<uint8_t>(10, 0xab)), COMMAND_CLASS_AUXILIARY);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            handler.push_message(Message(0x202, 0xc3c9, 101, std::vector<uint8_t>(10, 0xab)), COMMAND_CLASS_GIMBAL_VELOCITY);
+            // a retry of the blocked send has to see the newer setpoint before the transport accepts the held one
+            std::this_thread::sleep_for(std::chrono::milliseconds(20)); proxy.blocked = 0x0;
+
+            StreamParser parser; std::vector<uint16_t> sequences; std::array<can_frame, 16> frames{}; std::array<std::chrono::system_clock::time_point, 16> timestamps{}; size_t count = 0;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+            while (sequences.size() < 3 && std::chrono::steady_clock::now() < deadline && remote->read_frames(frames, timestamps, count)) {
+                for (size_t i = 0; i < count; i++) {
+                    if (frames[i].can_id != 0x202) { continue; }
+                    parser.push(std::span{frames[i].data, frames[i].can_dlc}, timestamps[i], [&sequences](const std::span<const uint8_t> data, auto, auto) { sequences.push_back(Message(0x202, data).get_sequence()); });
+                }
+            }
+            ASSERT_EQ(sequences, (std::vector<uint16_t>{200, 101}));
+        }
+    }
+
+    TEST(HandlerTest, SendFailure) {
+        auto [local, remote] = LoopbackBus::create_pair();
+        auto bus = std::make_unique<ProxyBus>(std::move(local)); bus->status = SEND_STATUS_FAILED;
+        Handler handler{std::move(bus)};
+        ASSERT_TRUE(handler.init("loopback"));
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (handler.is_running() && std::chrono::steady_clock::now() < deadline) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+        ASSERT_FALSE(handler.is_running());
+    }
+} // namespace robomaster
@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <linux/can.h>
+#include <algorithm>
+#include <vector>
+
+#include "robomaster/message.h"
+
+namespace robomaster {
+    /**
+     * @brief Split a RoboMaster message into CAN frames of up to 8 bytes, addressed to the device id of the message.
+     *
+     * @param message The RoboMaster message.
+     * @return std::vector<can_frame> as frames.
+     */
+    inline std::vector<can_frame> encode(const Message& message) {
+        std::vector<can_frame> frames; const auto data = message.vector();
+        for (size_t i = 0; i < data.size(); i += 8) {
+            can_frame frame{}; frame.can_id = message.get_device_id(); frame.can_dlc = std::min(static_cast<size_t>(8), data.size() - i);
+            std::copy_n(data.begin() + static_cast<long>(i), frame.can_dlc, frame.data); frames.push_back(frame);
+        } return frames;
+    }
+} // namespace robomaster
@@ -168,4 +168,22 @@ namespace robomaster {
         ASSERT_FALSE(msg.is_valid());
         ASSERT_EQ(msg.get_payload().size(), 0);
     }
+
+    TEST(MessageTest, Encode) {
+        const auto msg = Message(0x201, 0xc3c9, 7, {0x40, 0x3f, 0x19, 0x01});
+        std::array<uint8_t, STD_MAX_MESSAGE_LENGTH> buffer{};
+
+        ASSERT_EQ(msg.encode(buffer), 14);
+        ASSERT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + 14), msg.vector());
+        ASSERT_EQ(msg.encode(std::span{buffer}.first(13)), 0);
+
+        const auto copy = Message(0x201, std::span{buffer}.first(14));
+        ASSERT_TRUE(copy.is_valid());
+        ASSERT_EQ(copy.get_sequence(), 7);
+        ASSERT_EQ(copy.get_uint8(3), 0x01);
+
+        const auto longest = Message(0x201, 0xc3c9, 7, std::vector<uint8_t>(300, 0x42));
+        ASSERT_EQ(longest.get_payload().size(), STD_MAX_PAYLOAD_LENGTH);
+        ASSERT_EQ(longest.encode(buffer), 255);
+    }
 } // namespace robomaster
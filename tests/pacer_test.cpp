@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <random>
+
+#include "robomaster/pacer.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(PacerTest, FrameBits) {
+        can_frame frame{}; frame.can_id = 0x0; frame.can_dlc = 0;
+        ASSERT_EQ(Pacer::frame_bits(frame), 53);
+
+        std::mt19937 generator{3}; std::uniform_int_distribution<int> byte{0, 0xff};
+        for (size_t i = 0; i < 1000; i++) {
+            frame.can_id = static_cast<canid_t>(byte(generator) << 3 | 0x201); frame.can_dlc = static_cast<uint8_t>(i % 9);
+            for (auto& value : frame.data) { value = static_cast<uint8_t>(byte(generator)); }
+            const auto nominal = 47 + 8 * static_cast<size_t>(frame.can_dlc), worst = nominal + (33 + 8 * static_cast<size_t>(frame.can_dlc)) / 4;
+            ASSERT_GE(Pacer::frame_bits(frame), nominal); ASSERT_LE(Pacer::frame_bits(frame), worst);
+        }
+        frame.can_id = 0x201 | CAN_EFF_FLAG; frame.can_dlc = 8;
+        ASSERT_GE(Pacer::frame_bits(frame), 67 + 64);
+    }
+
+    TEST(PacerTest, Bucket) {
+        Pacer pacer{1000000, 0.5, std::chrono::microseconds(300)}; const auto now = std::chrono::steady_clock::now();
+        can_frame frame{}; frame.can_id = 0x201; frame.can_dlc = 8; const auto time = std::chrono::microseconds(Pacer::frame_bits(frame) * 2);
+
+        ASSERT_TRUE(pacer.is_ready(now));
+        pacer.consume(std::span{&frame, 1}, now);
+        ASSERT_TRUE(pacer.is_ready(now));
+        pacer.consume(std::span{&frame, 1}, now);
+        ASSERT_FALSE(pacer.is_ready(now));
+        ASSERT_EQ(pacer.ready_time(), now + 2 * time - std::chrono::microseconds(300));
+        ASSERT_TRUE(pacer.is_ready(now + 2 * time));
+    }
+
+    TEST(PacerTest, Disabled) {
+        Pacer pacer; const auto now = std::chrono::steady_clock::now(); can_frame frame{}; frame.can_dlc = 8;
+        for (size_t i = 0; i < 100; i++) { pacer.consume(std::span{&frame, 1}, now); }
+        ASSERT_TRUE(pacer.is_ready(now));
+    }
+} // namespace robomaster
@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <random>
+#include <vector>
+
+#include "robomaster/parser.h"
+#include "robomaster/message.h"
+#include "robomaster/utils.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    static std::vector<std::vector<uint8_t>> parse(StreamParser& parser, const std::vector<uint8_t>& stream, const size_t chunk) {
+        std::vector<std::vector<uint8_t>> messages;
+        for (size_t i = 0; i < stream.size(); i += chunk) {
+            const auto data = std::span{stream}.subspan(i, std::min(chunk, stream.size() - i));
+            parser.push(data, std::chrono::system_clock::time_point{std::chrono::seconds(i)}, [&messages](const std::span<const uint8_t> message, auto, auto) { messages.emplace_back(message.begin(), message.end()); });
+        } return messages;
+    }
+
+    TEST(ParserTest, Frames) {
+        StreamParser parser; const auto data = Message(0x202, 0xc3c9, 7, std::vector<uint8_t>(40, 0xab)).vector();
+        const auto messages = parse(parser, data, 8);
+        ASSERT_EQ(messages.size(), 1);
+        ASSERT_EQ(messages[0], data);
+    }
+
+    TEST(ParserTest, Timestamps) {
+        StreamParser parser; const auto data = Message(0x202, 0xc3c9, 7, std::vector<uint8_t>(20, 0xab)).vector();
+        std::vector<std::pair<std::chrono::system_clock::time_point, std::chrono::system_clock::time_point>> times;
+        for (size_t i = 0; i < data.size(); i += 8) {
+            parser.push(std::span{data}.subspan(i, std::min<size_t>(8, data.size() - i)), std::chrono::system_clock::time_point{std::chrono::seconds(i + 1)}, [&times](auto, const auto first, const auto last) { times.emplace_back(first, last); });
+        }
+        ASSERT_EQ(times.size(), 1);
+        ASSERT_EQ(times[0].first, std::chrono::system_clock::time_point{std::chrono::seconds(1)});
+        ASSERT_EQ(times[0].second, std::chrono::system_clock::time_point{std::chrono::seconds(25)});
+    }
+
+    TEST(ParserTest, BackToBack) {
+        StreamParser parser; std::vector<uint8_t> stream;
+        for (uint16_t i = 0; i < 5; i++) { const auto data = Message(0x203, 0x0904, i, std::vector<uint8_t>(3 + i, 0x55)).vector(); stream.insert(stream.end(), data.begin(), data.end()); }
+        for (const size_t chunk : {1, 3, 8, 64}) {
+            const auto messages = parse(parser, stream, chunk);
+            ASSERT_EQ(messages.size(), 5);
+            for (uint16_t i = 0; i < 5; i++) { ASSERT_EQ(Message(0x203, messages[i]).get_sequence(), i); }
+        }
+    }
+
+    TEST(ParserTest, Resync) {
+        StreamParser parser; const auto data = Message(0x211, 0x0938, 3, std::vector<uint8_t>(12, 0x01)).vector();
+        std::vector<uint8_t> stream = { 0x00, 0x55, 0x55, 0x12, 0x55, 0x0b, 0x04 }; stream.reserve(stream.size() + data.size());
+        stream.insert(stream.end(), data.begin(), data.end());
+        const auto messages = parse(parser, stream, 8);
+        ASSERT_EQ(messages.size(), 1);
+        ASSERT_EQ(messages[0], data);
+    }
+
+    TEST(ParserTest, NoisyStream) {
+        std::mt19937 generator{7}; std::uniform_int_distribution<int> byte{0, 0xff}; std::vector<uint8_t> stream;
+        for (uint16_t i = 0; i < 20; i++) {
+            std::vector<uint8_t> noise(static_cast<size_t>(byte(generator)));
+            for (auto& value : noise) { value = byte(generator) < 0x80 ? 0x55 : static_cast<uint8_t>(byte(generator)); }
+            noise.resize(noise.size() + 3, 0x00);
+            for (size_t j = 0; j + 3 < noise.size(); j++) { if (noise[j] == 0x55 && noise[j + 1] >= 11 && noise[j + 3] == get_crc8(&noise[j], 3)) { noise[j + 3] ^= 0x01; } }
+            const auto data = Message(0x202, 0x0903, i, std::vector<uint8_t>(i + 1, 0x55)).vector();
+            stream.insert(stream.end(), noise.begin(), noise.end()); stream.insert(stream.end(), data.begin(), data.end());
+        }
+        for (const size_t chunk : {1, 7, 8, 16, 17, 64, 4096}) {
+            StreamParser parser; const auto messages = parse(parser, stream, chunk);
+            ASSERT_EQ(messages.size(), 20) << "chunk " << chunk;
+            for (uint16_t i = 0; i < 20; i++) { ASSERT_EQ(Message(0x202, messages[i]).get_sequence(), i); }
+        }
+    }
+
+    TEST(ParserTest, InvalidChecksum) {
+        StreamParser parser; auto corrupted = Message(0x202, 0xc3c9, 1, std::vector<uint8_t>(16, 0x10)).vector(); corrupted[12] ^= 0xff;
+        const auto data = Message(0x202, 0xc3c9, 2, std::vector<uint8_t>(16, 0x20)).vector();
+        std::vector<uint8_t> stream = corrupted; stream.insert(stream.end(), data.begin(), data.end());
+        const auto messages = parse(parser, stream, 8);
+        ASSERT_EQ(messages.size(), 1);
+        ASSERT_EQ(Message(0x202, messages[0]).get_sequence(), 2);
+    }
+
+    TEST(ParserTest, MaxLength) {
+        StreamParser parser; const auto data = Message(0x202, 0xc3c9, 1, std::vector<uint8_t>(245, 0x42)).vector();
+        ASSERT_EQ(data.size(), 255);
+        const auto messages = parse(parser, data, 8);
+        ASSERT_EQ(messages.size(), 1);
+        ASSERT_EQ(messages[0], data);
+    }
+} // namespace robomaster
@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "robomaster/pipeline.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(PipelineTest, Order) {
+        Pipeline pipeline; std::vector<uint8_t> values; std::promise<void> promise;
+        ASSERT_TRUE(pipeline.init([&values, &promise](const RawMessage& message) {
+            values.push_back(message.data[message.length - 1]); if (values.size() == 100) { promise.set_value(); }
+        }));
+        for (uint8_t i = 0; i < 100; i++) {
+            const std::vector<uint8_t> data(11, i); ASSERT_TRUE(pipeline.push(0, 0x202, data, {}, {}));
+            if (i % 10 == 0) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+        }
+        ASSERT_EQ(promise.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+        for (uint8_t i = 0; i < 100; i++) { ASSERT_EQ(values[i], i); }
+        ASSERT_EQ(pipeline.stats().messages_dropped, 0);
+    }
+
+    TEST(PipelineTest, Backpressure) {
+        Pipeline pipeline; std::mutex mutex; std::unique_lock lock{mutex}; size_t count = 0;
+        ASSERT_TRUE(pipeline.init([&mutex, &count](const RawMessage&) { std::lock_guard guard{mutex}; count++; }));
+
+        const std::vector<uint8_t> data(STD_MAX_MESSAGE_LENGTH, 0xab); size_t pushed = 0;
+        for (size_t i = 0; i < STD_PIPELINE_CAPACITY + 10; i++) { if (pipeline.push(1, 0x203, data, {}, {})) { pushed++; } }
+        const auto stats = pipeline.stats();
+        ASSERT_GE(pushed, STD_PIPELINE_CAPACITY);
+        ASSERT_EQ(stats.messages_dropped, STD_PIPELINE_CAPACITY + 10 - pushed);
+        ASSERT_EQ(stats.capacity, STD_PIPELINE_CAPACITY);
+        ASSERT_GE(stats.max_depth, STD_PIPELINE_CAPACITY - 1);
+
+        lock.unlock(); pipeline.stop();
+        ASSERT_EQ(count, pushed);
+        ASSERT_EQ(pipeline.stats().depth, 0);
+    }
+} // namespace robomaster
@@ -22,6 +22,9 @@
  * SOFTWARE.
  */
 
+#include <thread>
+#include <vector>
+
 #include "robomaster/queue.h"
 #include "gtest/gtest.h"
 
@@ -69,4 +72,82 @@ namespace robomaster {
         ASSERT_EQ(queue.size(), 0);
         ASSERT_TRUE(queue.empty());
     }
+
+    TEST(QueueTest, Overflow) {
+        Queue queue;
+
+        for (uint16_t i = 0; i < 10; i++) { ASSERT_TRUE(queue.push(Message(0x202, 1337, i, std::vector{static_cast<uint8_t>(i)}))); }
+        ASSERT_FALSE(queue.push(Message(0x202, 1337, 10, std::vector{static_cast<uint8_t>(10)})));
+
+        ASSERT_EQ(queue.size(), 10);
+        ASSERT_EQ(queue.pop().get_sequence(), 1);
+    }
+
+    TEST(QueueTest, Priority) {
+        Queue queue;
+
+        for (uint16_t i = 0; i < 12; i++) { queue.push(Message(0x202, 1337, i, std::vector{static_cast<uint8_t>(i)}), COMMAND_CLASS_AUXILIARY); }
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 100, std::vector{static_cast<uint8_t>(100)}), COMMAND_CLASS_GIMBAL));
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 101, std::vector{static_cast<uint8_t>(101)}), COMMAND_CLASS_SAFETY));
+
+        ASSERT_EQ(queue.size(), 12);
+        ASSERT_EQ(queue.pop().get_sequence(), 101);
+        ASSERT_EQ(queue.pop().get_sequence(), 100);
+        ASSERT_EQ(queue.pop().get_sequence(), 2);
+    }
+
+    TEST(QueueTest, Coalescing) {
+        Queue queue;
+
+        for (uint16_t i = 0; i < 5; i++) { ASSERT_TRUE(queue.push(Message(0x202, 1337, i, std::vector{static_cast<uint8_t>(i)}), COMMAND_CLASS_CHASSIS_VELOCITY)); }
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 10, std::vector{static_cast<uint8_t>(10)}), COMMAND_CLASS_GIMBAL_VELOCITY));
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 11, std::vector{static_cast<uint8_t>(11)}), COMMAND_CLASS_GIMBAL_VELOCITY));
+
+        ASSERT_EQ(queue.size(), 2);
+        ASSERT_EQ(queue.pop().get_sequence(), 4);
+        ASSERT_EQ(queue.pop().get_sequence(), 11);
+        ASSERT_TRUE(queue.empty());
+    }
+
+    TEST(QueueTest, Superseded) {
+        Queue queue; auto msg = Message(0x0, {}); CommandClass command_class{};
+
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 1, std::vector<uint8_t>{1}), COMMAND_CLASS_GIMBAL_VELOCITY));
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 2, std::vector<uint8_t>{2}), COMMAND_CLASS_AUXILIARY));
+        ASSERT_TRUE(queue.pop(msg, command_class));
+        ASSERT_EQ(command_class, COMMAND_CLASS_GIMBAL_VELOCITY);
+        ASSERT_FALSE(queue.is_superseded(COMMAND_CLASS_GIMBAL_VELOCITY));
+
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 3, std::vector<uint8_t>{3}), COMMAND_CLASS_GIMBAL_VELOCITY));
+        ASSERT_TRUE(queue.push(Message(0x202, 1337, 4, std::vector<uint8_t>{4}), COMMAND_CLASS_AUXILIARY));
+        ASSERT_TRUE(queue.is_superseded(COMMAND_CLASS_GIMBAL_VELOCITY));
+        ASSERT_FALSE(queue.is_superseded(COMMAND_CLASS_AUXILIARY));
+    }
+
+    TEST(QueueTest, Capacity) {
+        Queue queue; auto capacity = STD_QUEUE_CAPACITY; capacity[COMMAND_CLASS_AUXILIARY] = 2; capacity[COMMAND_CLASS_CHASSIS_VELOCITY] = 3;
+        queue.set_capacity(capacity);
+
+        for (uint16_t i = 0; i < 3; i++) { queue.push(Message(0x202, 1337, i, std::vector{static_cast<uint8_t>(i)}), COMMAND_CLASS_AUXILIARY); }
+        for (uint16_t i = 0; i < 3; i++) { ASSERT_TRUE(queue.push(Message(0x202, 1337, i, std::vector{static_cast<uint8_t>(i)}), COMMAND_CLASS_CHASSIS_VELOCITY)); }
+
+        ASSERT_EQ(queue.size(), 5);
+        ASSERT_EQ(queue.pop().get_sequence(), 0);
+        ASSERT_EQ(queue.pop().get_sequence(), 1);
+        ASSERT_EQ(queue.pop().get_sequence(), 2);
+        ASSERT_EQ(queue.pop().get_sequence(), 1);
+    }
+
+    TEST(QueueTest, Producers) {
+        MPMCRing<uint32_t, 64> ring; std::vector<std::thread> producers; std::vector<uint32_t> next(4);
+        for (uint32_t p = 0; p < 4; p++) {
+            producers.emplace_back([&ring, p] { for (uint32_t i = 0; i < 10000; i++) { while (!ring.push(p << 16 | i)) { std::this_thread::yield(); } } });
+        }
+        for (size_t count = 0; count < 40000;) {
+            uint32_t value; if (!ring.pop(value)) { std::this_thread::yield(); continue; }
+            ASSERT_EQ(value & 0xffff, next[value >> 16]++); count++;
+        }
+        for (auto& producer : producers) { producer.join(); }
+        ASSERT_TRUE(ring.empty());
+    }
 } // namespace robomaster
@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <future>
+
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "robomaster/reactor.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(ReactorTest, Dispatch) {
+        Reactor reactor; ASSERT_TRUE(reactor.init());
+        const auto descriptor = eventfd(0, EFD_NONBLOCK); std::promise<uint64_t> promise;
+        ASSERT_TRUE(reactor.add(descriptor, [&](uint32_t) {
+            uint64_t value = 0; if (read(descriptor, &value, sizeof(value)) == sizeof(value)) { promise.set_value(value); }
+        }));
+
+        constexpr uint64_t value = 3; ASSERT_EQ(write(descriptor, &value, sizeof(value)), sizeof(value));
+        auto future = promise.get_future();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+        ASSERT_EQ(future.get(), 3);
+        reactor.remove(descriptor); close(descriptor);
+    }
+
+    TEST(ReactorTest, RemoveFromCallback) {
+        Reactor reactor; ASSERT_TRUE(reactor.init());
+        const auto descriptor = eventfd(1, EFD_NONBLOCK); std::atomic<size_t> count{0};
+        ASSERT_TRUE(reactor.add(descriptor, [&](uint32_t) { count++; reactor.remove(descriptor); }));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_EQ(count.load(), 1);
+        reactor.stop(); close(descriptor);
+    }
+} // namespace robomaster
@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <set>
+
+#include "robomaster/registry.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(RegistryTest, Index) {
+        static_assert(Registry::index(0x202) == 0);
+        static_assert(Registry::index(0x201) == Registry::size);
+        for (size_t i = 0; i < Registry::size; i++) { ASSERT_EQ(Registry::index(Registry::device_ids[i]), i); ASSERT_EQ(Registry::route(i).device_id, Registry::device_ids[i]); }
+        for (const uint32_t id : { 0x0u, 0x200u, 0x204u, 0x210u, 0x215u, 0x7ffu, 0xffffffffu }) { ASSERT_EQ(Registry::index(id), Registry::size); }
+        ASSERT_EQ(std::set(Registry::device_ids.begin(), Registry::device_ids.end()).size(), Registry::size);
+    }
+
+    TEST(RegistryTest, Match) {
+        const auto index = Registry::index(0x203);
+        ASSERT_TRUE(Registry::match(index, Message(0x203, 0x0904, 0, { 0x00, 0x3f, 0x76, 0x01 })));
+        ASSERT_TRUE(Registry::match(index, Message(0x203, 0x0904, 0, { 0x00, 0x3f, 0x76 })));
+        ASSERT_FALSE(Registry::match(index, Message(0x203, 0x0904, 0, { 0x00, 0x3f })));
+        ASSERT_FALSE(Registry::match(index, Message(0x203, 0x0904, 0, { 0x00, 0x3f, 0x77, 0x01 })));
+        ASSERT_FALSE(Registry::match(index, Message(0x203, 0x0903, 0, { 0x00, 0x3f, 0x76, 0x01 })));
+    }
+
+    TEST(RegistryTest, Decode) {
+        RoboMasterState state{}; const auto time = std::chrono::system_clock::time_point{std::chrono::seconds(1)};
+        auto message = Message(0x212, 0x0958, 0, { 0x00, 0x3f, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }); message.set_timestamps(time, time);
+        Registry::route(Registry::index(0x212)).decode(message, state);
+        ASSERT_EQ(state.time.detector[1], time);
+        ASSERT_EQ(state.time.detector[0], std::chrono::system_clock::time_point{});
+    }
+} // namespace robomaster
@@ -0,0 +1,50 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <pthread.h>
+#include <atomic>
+
+#include "robomaster/scheduling.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(SchedulingTest, NameAndAffinity) {
+        std::atomic<bool> is_stopped{false}; std::thread thread{[&is_stopped] { while (!is_stopped) { std::this_thread::yield(); } }};
+        ASSERT_TRUE(set_thread_config(thread, ThreadConfig{.name = "robomaster-test-thread", .cpus = {0}}));
+
+        std::array<char, 16> name{}; ASSERT_EQ(pthread_getname_np(thread.native_handle(), name.data(), name.size()), 0);
+        ASSERT_STREQ(name.data(), "robomaster-test");
+        cpu_set_t set; CPU_ZERO(&set); ASSERT_EQ(pthread_getaffinity_np(thread.native_handle(), sizeof(set), &set), 0);
+        ASSERT_EQ(CPU_COUNT(&set), 1);
+        ASSERT_TRUE(CPU_ISSET(0, &set));
+        is_stopped = true; thread.join();
+    }
+
+    TEST(SchedulingTest, Failure) {
+        std::atomic<bool> is_stopped{false}; std::thread thread{[&is_stopped] { while (!is_stopped) { std::this_thread::yield(); } }};
+        ASSERT_FALSE(set_thread_config(thread, ThreadConfig{.cpus = {CPU_SETSIZE}}));
+        ASSERT_FALSE(set_thread_config(thread, ThreadConfig{.policy = SCHED_FIFO, .priority = 100}));
+        is_stopped = true; thread.join();
+    }
+} // namespace robomaster
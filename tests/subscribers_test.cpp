@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "robomaster/subscribers.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(SubscribersTest, Filter) {
+        Subscribers<int> subscribers; std::vector<int> all, device, type;
+        ASSERT_EQ(subscribers.add([&all](const int value) { all.push_back(value); }), 0);
+        ASSERT_EQ(subscribers.add([&device](const int value) { device.push_back(value); }, 0x202), 1);
+        ASSERT_EQ(subscribers.add([&type](const int value) { type.push_back(value); }, 0x202, 0x0904), 2);
+        subscribers.publish(0x202, 0x0904, 1); subscribers.publish(0x202, 0x0903, 2); subscribers.publish(0x203, 0x0904, 3);
+        ASSERT_EQ(all, (std::vector<int>{1, 2, 3}));
+        ASSERT_EQ(device, (std::vector<int>{1, 2}));
+        ASSERT_EQ(type, (std::vector<int>{1}));
+        ASSERT_EQ(subscribers.size(), 3);
+    }
+
+    TEST(SubscribersTest, Remove) {
+        Subscribers<int> subscribers; int count = 0;
+        const auto id = subscribers.add([&count](int) { count++; });
+        subscribers.publish(0x202, 0x0, 0);
+        ASSERT_TRUE(subscribers.remove(id));
+        ASSERT_FALSE(subscribers.remove(id));
+        ASSERT_FALSE(subscribers.remove(STD_MAX_SUBSCRIBERS));
+        subscribers.publish(0x202, 0x0, 0);
+        ASSERT_EQ(count, 1);
+
+        size_t self = STD_MAX_SUBSCRIBERS; self = subscribers.add([&subscribers, &self, &count](int) { count++; ASSERT_TRUE(subscribers.remove(self)); });
+        subscribers.publish(0x202, 0x0, 0); subscribers.publish(0x202, 0x0, 0);
+        ASSERT_EQ(count, 2);
+        ASSERT_EQ(subscribers.size(), 0);
+        for (size_t i = 0; i < STD_MAX_SUBSCRIBERS; i++) { ASSERT_EQ(subscribers.add([](int) { }), i); }
+        ASSERT_EQ(subscribers.add([](int) { }), STD_MAX_SUBSCRIBERS);
+    }
+
+    TEST(SubscribersTest, Concurrent) {
+        Subscribers<int> subscribers; std::atomic<bool> is_stopped{false};
+        std::thread publisher{[&subscribers, &is_stopped] { while (!is_stopped) { subscribers.publish(0x202, 0x0, 1); } }};
+        for (size_t i = 0; i < 1000; i++) {
+            auto value = std::make_shared<std::atomic<int>>(0); const auto id = subscribers.add([value](const int add) { value->fetch_add(add); });
+            ASSERT_NE(id, STD_MAX_SUBSCRIBERS);
+            ASSERT_TRUE(subscribers.remove(id));
+            const auto count = value->load(); std::this_thread::yield();
+            ASSERT_EQ(value->load(), count);
+        }
+        is_stopped = true; publisher.join();
+    }
+} // namespace robomaster
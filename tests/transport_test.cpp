@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Vinzenz Weist
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#include "robomaster/loopback.h"
+#include "robomaster/replay.h"
+#include "robomaster/uring.h"
+#include "gtest/gtest.h"
+
+namespace robomaster {
+    TEST(TransportTest, Loopback) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.1);
+        std::array<can_frame, 4> frames{}; std::array<std::chrono::system_clock::time_point, 4> timestamps{}; size_t count = 0;
+
+        can_frame frame{}; frame.can_id = 0x202; frame.can_dlc = 2; frame.data[0] = 0xde; frame.data[1] = 0xad;
+        ASSERT_EQ(local->send_frames(std::array{frame, frame, frame}), SEND_STATUS_SENT);
+        ASSERT_TRUE(remote->read_frames(frames, timestamps, count));
+        ASSERT_EQ(count, 3);
+        ASSERT_EQ(frames[2].can_id, 0x202);
+        ASSERT_EQ(frames[2].can_dlc, 2);
+        ASSERT_EQ(frames[2].data[1], 0xad);
+
+        ASSERT_TRUE(remote->read_frames(frames, timestamps, count));
+        ASSERT_EQ(count, 0);
+    }
+
+    TEST(TransportTest, LoopbackBusy) {
+        auto [local, remote] = LoopbackBus::create_pair();
+        const std::vector<can_frame> frames(1024, can_frame{});
+        ASSERT_EQ(local->send_frames(frames), SEND_STATUS_SENT);
+        ASSERT_EQ(local->send_frames(frames), SEND_STATUS_BUSY);
+    }
+
+    TEST(TransportTest, LoopbackFilter) {
+        auto [local, remote] = LoopbackBus::create_pair(); remote->set_timeout(0.1);
+        std::array<can_frame, 4> frames{}; std::array<std::chrono::system_clock::time_point, 4> timestamps{}; size_t count = 0;
+        ASSERT_TRUE(remote->set_filter(std::array<uint32_t, 1>{0x203}));
+
+        can_frame first{}; first.can_id = 0x202; can_frame second{}; second.can_id = 0x203;
+        ASSERT_EQ(local->send_frames(std::array{first, second, first}), SEND_STATUS_SENT);
+        ASSERT_TRUE(remote->read_frames(frames, timestamps, count));
+        ASSERT_EQ(count, 1);
+        ASSERT_EQ(frames[0].can_id, 0x203);
+    }
+
+    TEST(TransportTest, Replay) {
+        const auto path = testing::TempDir() + "robomaster_replay.log";
+        std::ofstream{path} << "(1700000000.250000) can0 202#55AB04\n" << "invalid line\n" << "(1700000000.500000) can0 211#0102030405060708\n" << "(1700000001.000000) can0 12345678#01\n";
+
+        ReplayBus replay; replay.set_timeout(0.0);
+        std::array<can_frame, 4> frames{}; std::array<std::chrono::system_clock::time_point, 4> timestamps{}; size_t count = 0;
+        ASSERT_FALSE(ReplayBus{}.init(path + ".missing"));
+        ASSERT_TRUE(replay.init(path));
+        ASSERT_TRUE(replay.set_filter(std::array<uint32_t, 2>{0x202, 0x211}));
+        ASSERT_TRUE(replay.read_frames(frames, timestamps, count));
+
+        ASSERT_EQ(count, 2);
+        ASSERT_EQ(frames[0].can_id, 0x202);
+        ASSERT_EQ(frames[0].can_dlc, 3);
+        ASSERT_EQ(frames[0].data[0], 0x55);
+        ASSERT_EQ(frames[0].data[2], 0x04);
+        ASSERT_EQ(frames[1].can_id, 0x211);
+        ASSERT_EQ(frames[1].can_dlc, 8);
+        ASSERT_EQ(frames[1].data[7], 0x08);
+        ASSERT_EQ(timestamps[1] - timestamps[0], std::chrono::milliseconds(250));
+        ASSERT_EQ(timestamps[0].time_since_epoch(), std::chrono::milliseconds(1700000000250));
+
+        ASSERT_FALSE(replay.is_finished());
+        ASSERT_TRUE(replay.read_frames(frames, timestamps, count));
+        ASSERT_EQ(count, 0);
+        ASSERT_TRUE(replay.is_finished());
+        std::remove(path.c_str());
+    }
+
+    TEST(TransportTest, Uring) {
+        std::array<int, 2> sockets{}; ASSERT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets.data()), 0);
+        UringBus uring; uring.set_timeout(0.1);
+        std::array<can_frame, 4> frames{}; std::array<std::chrono::system_clock::time_point, 4> timestamps{}; size_t count = 0;
+        ASSERT_TRUE(uring.attach(sockets[0]));
+        ASSERT_TRUE(uring.set_filter(std::array<uint32_t, 2>{0x202, 0x203}));
+        ASSERT_GE(uring.get_descriptor(), 0);
+
+        std::array<can_frame, 6> sent{};
+        for (size_t i = 0; i < sent.size(); i++) { sent[i].can_id = i == 1 ? 0x204 : 0x202; sent[i].can_dlc = 1; sent[i].data[0] = static_cast<uint8_t>(i); }
+        for (const auto& frame : sent) { ASSERT_EQ(write(sockets[1], &frame, sizeof(frame)), sizeof(frame)); }
+
+        std::vector<uint8_t> received;
+        while (received.size() < 5 && uring.read_frames(frames, timestamps, count) && count != 0) { for (size_t i = 0; i < count; i++) { received.push_back(frames[i].data[0]); } }
+        ASSERT_EQ(received, (std::vector<uint8_t>{0, 2, 3, 4, 5}));
+        ASSERT_TRUE(uring.read_frames(frames, timestamps, count));
+        ASSERT_EQ(count, 0);
+
+        can_frame ordered{}; ordered.can_id = 0x202; ordered.can_dlc = 1;
+        for (size_t i = 0; i < 200; i++) {
+            ordered.data[0] = static_cast<uint8_t>(i); ASSERT_EQ(write(sockets[1], &ordered, sizeof(ordered)), sizeof(ordered));
+            if (i == 100) { ASSERT_EQ(write(sockets[1], &ordered, 4), 4); }
+        }
+        received.clear();
+        while (received.size() < 200 && uring.read_frames(frames, timestamps, count) && count != 0) { for (size_t i = 0; i < count; i++) { received.push_back(frames[i].data[0]); } }
+        ASSERT_EQ(received.size(), 200);
+        for (size_t i = 0; i < received.size(); i++) { ASSERT_EQ(received[i], i); }
+
+        ASSERT_EQ(uring.send_frames(sent), SEND_STATUS_SENT);
+        for (size_t i = 0; i < sent.size(); i++) {
+            can_frame frame{}; ASSERT_EQ(read(sockets[1], &frame, sizeof(frame)), sizeof(frame));
+            ASSERT_EQ(frame.data[0], i);
+        }
+        close(sockets[0]); close(sockets[1]);
+    }
+} // namespace robomaster
@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <random>
 
 #include "robomaster/utils.h"
 #include "robomaster/message.h"
@@ -64,4 +65,39 @@ namespace robomaster {
 
         ASSERT_NE(get_crc8(vector_enable.data(), vector_enable.size() - 2), crc8);
     }
-} // namespace robomaster
+
+    TEST(UtilTest, crc_kernels) {
+        std::mt19937 generator{3}; std::uniform_int_distribution<int> byte{0, 0xff}; std::vector<uint8_t> data(1024);
+        for (auto& value : data) { value = static_cast<uint8_t>(byte(generator)); }
+        ASSERT_TRUE(is_supported(CRC_KERNEL_TABLE)); ASSERT_TRUE(is_supported(get_crc_kernel()));
+        for (const auto kernel : { CRC_KERNEL_SLICING, CRC_KERNEL_CLMUL }) {
+            if (!is_supported(kernel)) { continue; }
+            for (size_t offset = 0; offset < 16; offset++) {
+                for (size_t length = 0; length + offset <= 300; length++) {
+                    ASSERT_EQ(get_crc16(data.data() + offset, length, kernel), get_crc16(data.data() + offset, length, CRC_KERNEL_TABLE)) << "kernel " << +kernel << " length " << length;
+                    ASSERT_EQ(get_crc8(data.data() + offset, length, kernel), get_crc8(data.data() + offset, length, CRC_KERNEL_TABLE)) << "kernel " << +kernel << " length " << length;
+                }
+            }
+            ASSERT_EQ(get_crc16(data.data(), data.size(), kernel), get_crc16(data.data(), data.size(), CRC_KERNEL_TABLE));
+        }
+        ASSERT_EQ(get_crc16(data.data(), data.size()), get_crc16(data.data(), data.size(), CRC_KERNEL_TABLE));
+        ASSERT_EQ(get_crc8(data.data(), data.size()), get_crc8(data.data(), data.size(), CRC_KERNEL_TABLE));
+    }
+
+    TEST(UtilTest, update_crc16) {
+        const auto data = Message(0x202, 0x0903, 1, std::vector<uint8_t>(140, 0x42)).vector(); const auto crc = get_crc16(data.data(), data.size());
+        for (const size_t part : {1, 3, 8, 16, 40}) {
+            uint16_t value = STD_CRC16_SEED; for (size_t i = 0; i < data.size(); i += part) { value = update_crc16(value, data.data() + i, std::min(part, data.size() - i)); }
+            ASSERT_EQ(value, crc);
+        }
+    }
+
+    TEST(UtilTest, crc_reference) {
+        const auto data = MSG_ENABLE.vector();
+        for (const auto kernel : { CRC_KERNEL_TABLE, CRC_KERNEL_SLICING, CRC_KERNEL_CLMUL }) {
+            if (!is_supported(kernel)) { continue; }
+            ASSERT_EQ(get_crc8(data.data(), 3, kernel), data[3]);
+            ASSERT_EQ(get_crc16(data.data(), data.size() - 2, kernel), get_little_endian(data[data.size() - 2], data[data.size() - 1]));
+        }
+    }
+} // namespace robomaster
\ No newline at end of file